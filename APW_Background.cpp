@@ -0,0 +1,99 @@
+// Background fetch task for the ApixuWeather library, ESP32 only
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+
+#include "APW_Background.h"
+
+#ifdef ESP32
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Start the fetch task on the other core
+***************************************************************************************/
+bool APW_Background::begin(String api_key, String city)
+{
+  if (handle) return false;
+
+  apiKey   = api_key;
+  location = city;
+
+  return xTaskCreatePinnedToCore(task, "APW_Background", BACKGROUND_STACK, this, 1,
+                                 &handle, BACKGROUND_CORE) == pdPASS;
+}
+
+/***************************************************************************************
+** Function name:           update
+** Description:             Take the latest published values
+***************************************************************************************/
+// The sketch buffer is exchanged for the latest published buffer, the task then fills
+// the buffer the sketch gave up
+bool APW_Background::update(void)
+{
+  if (!(latest.load() & FRESH)) return false;
+
+  reader = latest.exchange(reader) & ~FRESH;
+
+  // The changed bits only cover the set before, so a missed set means redraw all
+  APW_published &taking = buffer[reader];
+  if (taking.sequence != taken + 1)
+  {
+    taking.current.changed = 0xFFFF;
+    for (uint8_t i = 0; i < MAX_DAYS; i++) taking.forecast.changed[i] = 0xFFFF;
+  }
+  taken = taking.sequence;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           task, run
+** Description:             Fetch when the scheduler says new values are due
+***************************************************************************************/
+void APW_Background::task(void *param)
+{
+  ((APW_Background *)param)->run();
+}
+
+void APW_Background::run(void)
+{
+  while (true)
+  {
+    if (schedule.due())
+    {
+      if (weather.getForecast(&work.current, &work.forecast, apiKey, location))
+      {
+        schedule.fetched(&work.current);
+        publish();
+      }
+      else schedule.failed();
+    }
+
+    vTaskDelay(1000 / portTICK_PERIOD_MS);
+  }
+}
+
+/***************************************************************************************
+** Function name:           publish
+** Description:             Copy the parsed values to a free buffer and publish it
+***************************************************************************************/
+// The parse fills the task's own set, so its changed bits are against the set published
+// before. The copy is made on the task core, the exchange makes it visible at once.
+void APW_Background::publish(void)
+{
+  APW_published &filling = buffer[writer];
+
+  filling.current  = work.current;
+  filling.forecast = work.forecast;
+  filling.sequence = ++work.sequence;
+
+  work.current.changed = 0;
+  for (uint8_t i = 0; i < MAX_DAYS; i++) work.forecast.changed[i] = 0;
+
+  writer = latest.exchange(writer | FRESH) & ~FRESH;
+}
+
+#endif // ESP32
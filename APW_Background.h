@@ -0,0 +1,91 @@
+// Background fetch task for the ApixuWeather library, ESP32 only
+
+// The requests are made by a FreeRTOS task on the other core, so the sketch loop() is
+// never held up by the network or the parser. Each response is parsed into a set of
+// structures private to the task, then copied to a free buffer and published with one
+// atomic exchange. The sketch calls update() to take the latest published values,
+// which stay unchanged until its next update() call. Neither side ever waits for the
+// other, three buffers are used so there is always one free for the task to fill.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_Background_h
+#define APW_Background_h
+
+#ifdef ESP32
+
+#include <atomic>
+
+#include "ApixuWeather.h"
+#include "APW_Scheduler.h"
+
+#ifndef BACKGROUND_CORE
+  #define BACKGROUND_CORE  0    // Core for the task, the sketch loop() runs on core 1
+#endif
+
+#ifndef BACKGROUND_STACK
+  #define BACKGROUND_STACK 8192 // Task stack size in bytes
+#endif
+
+/***************************************************************************************
+** Description:   Structure for a published set of values
+***************************************************************************************/
+typedef struct APW_published {
+  APW_current  current;
+  APW_forecast forecast;
+  uint32_t     sequence = 0; // Count of the sets published by the task, 0 = none
+} APW_published;
+
+/***************************************************************************************
+** Description:   Background fetch class
+***************************************************************************************/
+class APW_Background {
+
+  public:
+    // The Apixu_Weather instance is used only by the task once begin() is called, set
+    // the units, client etc before begin()
+    APW_Background(Apixu_Weather &weather) : weather(weather) { }
+
+    // Start the task, the times of the requests are set by an APW_Scheduler. Returns
+    // false if the task could not be created or is already running.
+    bool begin(String api_key, String city);
+
+    // Take the latest values published by the task, returns true if there are newer
+    // values than the last call. The values at current() and forecast() do not change
+    // until the next call. If a published set was missed, all the changed bits are set.
+    bool update(void);
+
+    // Values taken by the last update(), empty until the first set is published
+    APW_current*  current(void)  { return &buffer[reader].current; }
+    APW_forecast* forecast(void) { return &buffer[reader].forecast; }
+
+  private:
+
+    static void task(void *param);
+    void run(void);
+    void publish(void);
+
+    Apixu_Weather &weather;
+    String         apiKey;
+    String         location;
+    APW_Scheduler  schedule;
+    TaskHandle_t   handle = nullptr;
+
+    APW_published  work;        // Filled by the parse, only used by the task
+    APW_published  buffer[3];   // Published sets
+    uint8_t        writer = 0;  // Buffer the task fills next
+    uint8_t        reader = 1;  // Buffer the sketch is reading
+    uint32_t       taken  = 0;  // Sequence of the set the sketch last took
+
+    // Buffer index of the latest published set, and FRESH if not yet taken
+    static const uint8_t FRESH = 0x04;
+    std::atomic<uint8_t> latest { 2 };
+};
+
+#endif // ESP32
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
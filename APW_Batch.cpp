@@ -0,0 +1,122 @@
+// Multi-location batch fetch for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+
+#include "APW_Batch.h"
+
+/***************************************************************************************
+** Function name:           getForecastBatch
+** Description:             Fetch the forecast for several locations
+***************************************************************************************/
+// Blocking version of beginBatch() and poll()
+bool APW_Batch::getForecastBatch(APW_location *location, uint8_t count, String api_key)
+{
+  if (!beginBatch(location, count, api_key)) return false;
+
+  while (!poll()) yield();
+
+  for (uint8_t i = 0; i < count; i++) if (location[i].state != APW_DONE) return false;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           beginBatch
+** Description:             Start a batch, up to BATCH_CONNECTIONS requests in flight
+***************************************************************************************/
+bool APW_Batch::beginBatch(APW_location *location, uint8_t count, String api_key)
+{
+  if (busy()) return false; // Only one batch at a time
+
+  this->location = location;
+  this->count    = count;
+  next = 0;
+  done = 0;
+  key  = api_key;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    location[i].state = APW_IDLE;
+    location[i].error = APW_NO_ERROR;
+  }
+
+  for (uint8_t i = 0; i < BATCH_CONNECTIONS; i++) startNext(i);
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           poll
+** Description:             Advance every request in flight by one step
+***************************************************************************************/
+// Each connection does one bounded step, see Apixu_Weather::poll(). A connection that
+// completes starts the next waiting location.
+bool APW_Batch::poll(void)
+{
+  if (!location) return true;
+
+  for (uint8_t i = 0; i < BATCH_CONNECTIONS; i++)
+  {
+    if (slot[i] < 0) continue;
+
+    APW_state state = weather[i].poll();
+    if (state < APW_DONE) continue;
+
+    APW_location &loc = location[slot[i]];
+    loc.state = state;
+    loc.error = weather[i].getError();
+    done++;
+
+    startNext(i);
+  }
+
+  if (done < count) return false;
+
+  key = ""; // Free the heap
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           startNext
+** Description:             Start the next waiting location on a connection
+***************************************************************************************/
+void APW_Batch::startNext(uint8_t index)
+{
+  slot[index] = -1;
+
+  while (next < count)
+  {
+    APW_location &loc = location[next];
+
+    if (weather[index].beginForecast(loc.current, loc.forecast, key, loc.city))
+    {
+      loc.state = APW_CONNECT;
+      slot[index] = next++;
+      return;
+    }
+
+    // Connection busy with a request not started by the batch
+    loc.state = APW_FAILED;
+    loc.error = APW_CONNECT_FAILED;
+    next++;
+    done++;
+  }
+}
+
+/***************************************************************************************
+** Function name:           setMetric, setServer
+** Description:             Apply a setting to all connections
+***************************************************************************************/
+void APW_Batch::setMetric(bool m)
+{
+  for (uint8_t i = 0; i < BATCH_CONNECTIONS; i++) weather[i].setMetric(m);
+}
+
+void APW_Batch::setServer(const char *host, uint16_t port)
+{
+  for (uint8_t i = 0; i < BATCH_CONNECTIONS; i++) weather[i].setServer(host, port);
+}
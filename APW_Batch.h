@@ -0,0 +1,75 @@
+// Multi-location batch fetch for the ApixuWeather library
+
+// Requests for several locations are kept in flight at the same time, each on its
+// own connection, and each response is parsed as its bytes arrive. The wall time for
+// a batch is then close to the time of the slowest request instead of the sum.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_Batch_h
+#define APW_Batch_h
+
+#include "ApixuWeather.h"
+
+#ifndef BATCH_CONNECTIONS
+  #define BATCH_CONNECTIONS 3 // Requests in flight, each has a client and parser
+#endif
+
+/***************************************************************************************
+** Description:   Structure for a batch location and its output slot
+***************************************************************************************/
+typedef struct APW_location {
+  String        city;                     // Location as passed to getForecast()
+  APW_current  *current  = nullptr;       // Output structures, created by the sketch
+  APW_forecast *forecast = nullptr;
+  APW_state     state    = APW_IDLE;      // APW_DONE or APW_FAILED when complete
+  APW_error     error    = APW_NO_ERROR;  // Reason for a failure
+} APW_location;
+
+/***************************************************************************************
+** Description:   Batch class
+***************************************************************************************/
+class APW_Batch {
+
+  public:
+    // Fetch the forecast for count locations, blocks until all are complete. Returns
+    // true if every location was fetched, the state of each is in its APW_location
+    bool getForecastBatch(APW_location *location, uint8_t count, String api_key);
+
+    // Non-blocking version, the batch is then advanced by calling poll() which returns
+    // true when every location is complete. Returns false if a batch is in progress
+    bool beginBatch(APW_location *location, uint8_t count, String api_key);
+    bool poll(void);
+
+    // True while a batch is in progress
+    bool busy(void) { return location && (done < count); }
+
+    // Set values to be metric (true) or imperial (false) for all connections
+    void setMetric(bool true_or_false);
+
+    // Set the server for all connections, default api.apixu.com port 80
+    void setServer(const char *host, uint16_t port = 80);
+
+    // Access to a connection e.g. to call setClient(), each needs its own client
+    Apixu_Weather& connection(uint8_t index) { return weather[index]; }
+
+  private:
+
+    // Start the next waiting location on a free connection
+    void startNext(uint8_t index);
+
+    Apixu_Weather weather[BATCH_CONNECTIONS];
+    int16_t       slot[BATCH_CONNECTIONS];  // Location index per connection, -1 if free
+
+    APW_location *location = nullptr;       // Locations passed by the sketch
+    uint8_t       count    = 0;             // Number of locations
+    uint8_t       next     = 0;             // Next location to start
+    uint8_t       done     = 0;             // Locations complete
+    String        key;                      // API key for the batch
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
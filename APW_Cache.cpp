@@ -0,0 +1,241 @@
+// Response cache for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+
+#include "APW_Cache.h"
+
+// Copy a value to the sketch's struct if it differs, and set its changed bit
+template <typename T>
+static void copyValue(T &to, const T &from, uint16_t &changed, uint16_t bit)
+{
+  if (to == from) return;
+  to = from;
+  changed |= bit;
+}
+
+/***************************************************************************************
+** Function name:           getForecast
+** Description:             Return fresh cached values or fetch them
+***************************************************************************************/
+// Blocking version of request() and poll(), the cached values are copied to the
+// structures passed by the sketch
+bool APW_Cache::getForecast(APW_current *current, APW_forecast *forecast,
+                            String api_key, String city)
+{
+  // Let a fetch for another city complete first
+  while (fetchCity.length() && !fetchCity.equals(city)) { poll(); yield(); }
+
+  APW_state result = request(api_key, city);
+
+  while (result < APW_DONE) { yield(); result = poll(); }
+
+  if (result != APW_DONE) return false;
+
+  return read(city, current, forecast);
+}
+
+/***************************************************************************************
+** Function name:           request
+** Description:             Check the cache and start a fetch if needed
+***************************************************************************************/
+// The response is parsed into the cache's own structs. The entry for the city, or
+// the entry it will replace, is only changed once the fetch completes, so cached
+// values stay readable during the fetch and are kept if it fails.
+APW_state APW_Cache::request(String api_key, String city)
+{
+  // Join a fetch in progress for the same city
+  if (fetchCity.length())
+  {
+    if (!fetchCity.equals(city)) return APW_IDLE;
+    coalesced++;
+    return weather.getState();
+  }
+
+  APW_cache_entry *e = find(city);
+
+  if (e && fresh(e)) { hits++; return APW_DONE; }
+
+  // Values of a location not in the response must not be left from another
+  workCurrent  = APW_current();
+  workForecast = APW_forecast();
+
+  if (!weather.beginForecast(&workCurrent, &workForecast, api_key, city))
+    return APW_FAILED; // Apixu_Weather instance busy with a request not made by the cache
+
+  if (e) stale++;
+  else misses++;
+
+  fetchCity = city;
+
+  return weather.getState();
+}
+
+/***************************************************************************************
+** Function name:           poll
+** Description:             Advance a fetch started by request()
+***************************************************************************************/
+APW_state APW_Cache::poll(void)
+{
+  if (!fetchCity.length()) return weather.getState();
+
+  APW_state result = weather.poll();
+
+  if (result == APW_DONE)
+  {
+    // Only now is the oldest entry replaced, or the stale entry updated
+    APW_cache_entry *e = find(fetchCity);
+    if (!e) e = replace();
+
+    e->city     = fetchCity;
+    e->current  = workCurrent;
+    e->forecast = workForecast;
+    e->valid    = true;
+    e->fetched  = millis();
+  }
+
+  // A failed fetch leaves the cached values as they were
+  if (result >= APW_DONE) fetchCity = "";
+
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           read
+** Description:             Copy the cached values for a city
+***************************************************************************************/
+// Values are copied even if they are out of date, fresh() is not checked. Only the
+// values that differ from those already in the sketch's structs are copied, and their
+// changed bits are added to the bits the sketch has not yet cleared, so each caller
+// sees what changed since its own last read.
+bool APW_Cache::read(String city, APW_current *current, APW_forecast *forecast)
+{
+  APW_cache_entry *e = find(city);
+
+  if (!e || !e->valid) return false;
+
+  // Both unit sets are cached, compare in the units now selected
+  weather.applyUnits(current, forecast);
+  weather.applyUnits(&e->current, &e->forecast);
+
+  if (current)
+  {
+    const APW_current &from = e->current;
+    uint16_t &changed = current->changed;
+    copyValue(current->name,               from.name,               changed, APW_CUR_NAME);
+    copyValue(current->region,             from.region,             changed, APW_CUR_REGION);
+    copyValue(current->country,            from.country,            changed, APW_CUR_COUNTRY);
+    copyValue(current->localtime_epoch,    from.localtime_epoch,    changed, APW_CUR_LOCALTIME);
+    copyValue(current->last_updated_epoch, from.last_updated_epoch, changed, APW_CUR_UPDATED);
+#ifndef TEXT_FROM_CODE
+    copyValue(current->text,               from.text,               changed, APW_CUR_TEXT);
+#endif
+    copyValue(current->condition,          from.condition,          changed, APW_CUR_CONDITION);
+    copyValue(current->is_day,             from.is_day,             changed, APW_CUR_IS_DAY);
+    copyValue(current->code,               from.code,               changed, APW_CUR_CODE);
+    copyValue(current->temp,               from.temp,               changed, APW_CUR_TEMP);
+    copyValue(current->alt_temp,           from.alt_temp,           changed, APW_CUR_TEMP);
+    copyValue(current->wind,               from.wind,               changed, APW_CUR_WIND);
+    copyValue(current->alt_wind,           from.alt_wind,           changed, APW_CUR_WIND);
+    copyValue(current->wind_degree,        from.wind_degree,        changed, APW_CUR_WIND_DEGREE);
+    copyValue(current->pressure,           from.pressure,           changed, APW_CUR_PRESSURE);
+    copyValue(current->alt_pressure,       from.alt_pressure,       changed, APW_CUR_PRESSURE);
+    copyValue(current->precip,             from.precip,             changed, APW_CUR_PRECIP);
+    copyValue(current->alt_precip,         from.alt_precip,         changed, APW_CUR_PRECIP);
+    copyValue(current->humidity,           from.humidity,           changed, APW_CUR_HUMIDITY);
+    copyValue(current->cloud,              from.cloud,              changed, APW_CUR_CLOUD);
+  }
+
+  if (forecast)
+  {
+    const APW_forecast &from = e->forecast;
+    for (uint8_t i = 0; i < MAX_DAYS; i++)
+    {
+      uint16_t &changed = forecast->changed[i];
+      copyValue(forecast->date_epoch[i],      from.date_epoch[i],      changed, APW_DAY_DATE);
+      copyValue(forecast->maxtemp[i],         from.maxtemp[i],         changed, APW_DAY_MAXTEMP);
+      copyValue(forecast->alt_maxtemp[i],     from.alt_maxtemp[i],     changed, APW_DAY_MAXTEMP);
+      copyValue(forecast->mintemp[i],         from.mintemp[i],         changed, APW_DAY_MINTEMP);
+      copyValue(forecast->alt_mintemp[i],     from.alt_mintemp[i],     changed, APW_DAY_MINTEMP);
+      copyValue(forecast->totalprecip[i],     from.totalprecip[i],     changed, APW_DAY_PRECIP);
+      copyValue(forecast->alt_totalprecip[i], from.alt_totalprecip[i], changed, APW_DAY_PRECIP);
+#ifndef TEXT_FROM_CODE
+      copyValue(forecast->text[i],            from.text[i],            changed, APW_DAY_TEXT);
+#endif
+      copyValue(forecast->condition[i],       from.condition[i],       changed, APW_DAY_CONDITION);
+      copyValue(forecast->code[i],            from.code[i],            changed, APW_DAY_CODE);
+      copyValue(forecast->sunrise[i],         from.sunrise[i],         changed, APW_DAY_SUNRISE);
+      copyValue(forecast->sunset[i],          from.sunset[i],          changed, APW_DAY_SUNSET);
+      copyValue(forecast->moonrise[i],        from.moonrise[i],        changed, APW_DAY_MOONRISE);
+      copyValue(forecast->moonset[i],         from.moonset[i],         changed, APW_DAY_MOONSET);
+    }
+  }
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           clear
+** Description:             Discard all cached values
+***************************************************************************************/
+void APW_Cache::clear(void)
+{
+  for (uint8_t i = 0; i < CACHE_ENTRIES; i++)
+  {
+    entry[i] = APW_cache_entry(); // Frees the Strings
+  }
+}
+
+/***************************************************************************************
+** Function name:           find
+** Description:             Find the entry for a city, nullptr if none
+***************************************************************************************/
+APW_cache_entry* APW_Cache::find(const String &city)
+{
+  for (uint8_t i = 0; i < CACHE_ENTRIES; i++)
+  {
+    if (entry[i].city.equals(city)) return &entry[i];
+  }
+
+  return nullptr;
+}
+
+/***************************************************************************************
+** Function name:           replace
+** Description:             Pick an entry for a new city, the oldest is replaced
+***************************************************************************************/
+APW_cache_entry* APW_Cache::replace(void)
+{
+  APW_cache_entry *oldest = nullptr;
+
+  for (uint8_t i = 0; i < CACHE_ENTRIES; i++)
+  {
+    if (!entry[i].valid) return &entry[i]; // Unused or failed fetch
+    if (!oldest || (millis() - entry[i].fetched) > (millis() - oldest->fetched))
+      oldest = &entry[i];
+  }
+
+  return oldest;
+}
+
+/***************************************************************************************
+** Function name:           fresh
+** Description:             True if the cached values have not been refreshed by the server
+***************************************************************************************/
+// The server clock is only known when the response arrives: localtime_epoch is then
+// the server time and last_updated_epoch when the values were last refreshed. The
+// time since the fetch is added to the age at the time of the fetch.
+bool APW_Cache::fresh(APW_cache_entry *e)
+{
+  if (!e->valid) return false;
+
+  uint32_t age = (millis() - e->fetched) / 1000;
+
+  if (e->current.localtime_epoch > e->current.last_updated_epoch)
+    age += e->current.localtime_epoch - e->current.last_updated_epoch;
+
+  return age < ttl;
+}
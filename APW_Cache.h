@@ -0,0 +1,94 @@
+// Response cache for the ApixuWeather library
+
+// The Apixu server only refreshes the weather conditions every 15 minutes, this
+// cache returns the stored current and forecast data while it is still fresh so a
+// sketch can ask for the weather as often as it likes without using API quota or
+// turning the radio on. Entries are keyed on the location and MAX_DAYS, both unit
+// sets are stored so the units set by setMetric() are applied when values are read.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_Cache_h
+#define APW_Cache_h
+
+#include "ApixuWeather.h"
+
+#ifndef CACHE_ENTRIES
+  #define CACHE_ENTRIES 2
+#endif
+
+#ifndef CACHE_TTL
+  #define CACHE_TTL 900
+#endif
+
+/***************************************************************************************
+** Description:   Structure for a cache entry
+***************************************************************************************/
+typedef struct APW_cache_entry {
+  String       city;             // Location as passed to getForecast()
+  bool         valid    = false; // Entry holds a complete response
+  uint32_t     fetched  = 0;     // millis() when the response was received
+  APW_current  current;
+  APW_forecast forecast;         // Always MAX_DAYS days, so days need not be in the key
+} APW_cache_entry;
+
+/***************************************************************************************
+** Description:   Cache class
+***************************************************************************************/
+class APW_Cache {
+
+  public:
+    APW_Cache(Apixu_Weather &weather) : weather(weather) { }
+
+    // Same as Apixu_Weather::getForecast() but returns the cached values while they
+    // are fresh, otherwise fetches and caches the response. Returns true if valid.
+    bool getForecast(APW_current *current, APW_forecast *forecast,
+                     String api_key, String city);
+
+    // Non-blocking: returns APW_DONE if fresh data is cached for the city, otherwise
+    // starts a fetch, or joins the fetch already in progress for the same city, then
+    // poll() must be called until APW_DONE or APW_FAILED is returned. Returns APW_IDLE
+    // if a fetch for another city is in progress, call again later. Cached values are
+    // only replaced when a fetch completes, they can be read during the fetch and are
+    // kept if it fails or cannot start.
+    APW_state request(String api_key, String city);
+    APW_state poll(void);
+
+    // Copy the cached values for a city in the units set by setMetric(), returns false
+    // if there are none. The changed bits of the values that differ from those in the
+    // structs passed are set, so keep the structs between reads as for getForecast().
+    bool read(String city, APW_current *current, APW_forecast *forecast);
+
+    // Seconds after the server's last_updated_epoch that the values are used (default
+    // CACHE_TTL). The server refreshes every 900s.
+    void setTTL(uint32_t seconds) { ttl = seconds; }
+
+    // Discard all cached values
+    void clear(void);
+
+    // Counters, fresh values returned, no entry found, entry found but out of date, and
+    // requests that joined a fetch already in progress for the same city
+    uint32_t hits      = 0;
+    uint32_t misses    = 0;
+    uint32_t stale     = 0;
+    uint32_t coalesced = 0;
+
+  private:
+
+    APW_cache_entry* find(const String &city);
+    APW_cache_entry* replace(void);
+    bool fresh(APW_cache_entry *entry);
+
+    Apixu_Weather  &weather;
+    APW_cache_entry entry[CACHE_ENTRIES];
+    APW_current     workCurrent;         // Filled by the fetch in progress, copied to
+    APW_forecast    workForecast;        // the entry for fetchCity when it completes
+    String          fetchCity;           // City of the fetch in progress, empty if none
+    uint32_t        ttl       = CACHE_TTL;
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
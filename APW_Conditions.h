@@ -0,0 +1,95 @@
+// Weather condition dictionary for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+// Used by ApixuWeather.cpp only. The server sends one of 48 condition codes with each
+// condition text. The codes run from 1000 to 1282 in steps of 3, so a code converts
+// to a slot directly and the slot table gives the row of the condition in the tables,
+// there is no search.
+
+#ifndef APW_Conditions_h
+#define APW_Conditions_h
+
+#ifndef CONDITION_TEXT_FILE
+  #define CONDITION_TEXT_FILE "APW_Conditions_en.h"
+#endif
+
+#define APW_CONDITIONS   48   // Number of condition codes
+#define APW_NO_CONDITION 0xFF // Not a known condition code
+
+// Slot of a condition code, APW_NO_CONDITION if the code is not in the code range
+constexpr uint8_t APW_conditionSlot(uint16_t code) {
+  return (code < 1000 || code > 1282 || (code - 1000) % 3) ? APW_NO_CONDITION : (code - 1000) / 3;
+}
+
+// Row of the condition for each slot, APW_NO_CONDITION for an unused code
+static const uint8_t APW_slotRow[95] PROGMEM = {
+    0,   1,   2,   3, 255, 255, 255, 255, 255, 255,   4, 255, 255, 255, 255, 255,
+  255, 255, 255, 255, 255,   5,   6,   7,   8, 255, 255, 255, 255,   9, 255, 255,
+  255, 255, 255, 255, 255, 255,  10,  11, 255, 255, 255, 255, 255,  12, 255, 255,
+  255,  13,  14,  15, 255, 255, 255, 255,  16,  17, 255, 255,  18,  19,  20,  21,
+   22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33, 255, 255, 255,  34,
+   35,  36,  37,  38,  39,  40,  41,  42,  43, 255, 255,  44,  45,  46,  47
+};
+
+// Icon index of each condition, see iconList[] in ApixuWeather.h
+static const uint8_t APW_conditionIcon[APW_CONDITIONS] PROGMEM = {
+   4, // 1000 Sunny
+   6, // 1003 Partly cloudy
+   8, // 1006 Cloudy
+   8, // 1009 Overcast
+   9, // 1030 Mist
+   1, // 1063 Patchy rain possible
+   3, // 1066 Patchy snow possible
+   2, // 1069 Patchy sleet possible
+   2, // 1072 Patchy freezing drizzle possible
+  11, // 1087 Thundery outbreaks possible
+   3, // 1114 Blowing snow
+   3, // 1117 Blizzard
+   9, // 1135 Fog
+   9, // 1147 Freezing fog
+  12, // 1150 Patchy light drizzle
+  12, // 1153 Light drizzle
+   2, // 1168 Freezing drizzle
+   2, // 1171 Heavy freezing drizzle
+  13, // 1180 Patchy light rain
+  13, // 1183 Light rain
+   1, // 1186 Moderate rain at times
+   1, // 1189 Moderate rain
+   1, // 1192 Heavy rain at times
+   1, // 1195 Heavy rain
+   2, // 1198 Light freezing rain
+   2, // 1201 Moderate or heavy freezing rain
+   2, // 1204 Light sleet
+   2, // 1207 Moderate or heavy sleet
+   3, // 1210 Patchy light snow
+   3, // 1213 Light snow
+   3, // 1216 Patchy moderate snow
+   3, // 1219 Moderate snow
+   3, // 1222 Patchy heavy snow
+   3, // 1225 Heavy snow
+  15, // 1237 Ice pellets
+   1, // 1240 Light rain shower
+   1, // 1243 Moderate or heavy rain shower
+   1, // 1246 Torrential rain shower
+   1, // 1249 Light sleet showers
+   2, // 1252 Moderate or heavy sleet showers
+   3, // 1255 Light snow showers
+   3, // 1258 Moderate or heavy snow showers
+  14, // 1261 Light showers of ice pellets
+  14, // 1264 Moderate or heavy showers of ice pellets
+  11, // 1273 Patchy light rain with thunder
+  11, // 1276 Moderate or heavy rain with thunder
+  11, // 1279 Patchy light snow with thunder
+   3  // 1282 Moderate or heavy snow with thunder
+};
+
+// Returned for an unknown code
+static const char APW_noCondition[] PROGMEM = "";
+
+// Condition text, in the language selected by CONDITION_TEXT_FILE
+#include CONDITION_TEXT_FILE
+
+#endif
@@ -0,0 +1,63 @@
+// English condition text for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+// The text matches the server responses in English. For another language copy this
+// file, translate the text (keep the order and the \0 after each condition) and set
+// CONDITION_TEXT_FILE to the new file name in User_Setup.h
+
+// One null terminated text per condition, in condition code order
+static const char APW_conditionText[] PROGMEM =
+  "Sunny\0"                                     // 1000
+  "Partly cloudy\0"                             // 1003
+  "Cloudy\0"                                    // 1006
+  "Overcast\0"                                  // 1009
+  "Mist\0"                                      // 1030
+  "Patchy rain possible\0"                      // 1063
+  "Patchy snow possible\0"                      // 1066
+  "Patchy sleet possible\0"                     // 1069
+  "Patchy freezing drizzle possible\0"          // 1072
+  "Thundery outbreaks possible\0"               // 1087
+  "Blowing snow\0"                              // 1114
+  "Blizzard\0"                                  // 1117
+  "Fog\0"                                       // 1135
+  "Freezing fog\0"                              // 1147
+  "Patchy light drizzle\0"                      // 1150
+  "Light drizzle\0"                             // 1153
+  "Freezing drizzle\0"                          // 1168
+  "Heavy freezing drizzle\0"                    // 1171
+  "Patchy light rain\0"                         // 1180
+  "Light rain\0"                                // 1183
+  "Moderate rain at times\0"                    // 1186
+  "Moderate rain\0"                             // 1189
+  "Heavy rain at times\0"                       // 1192
+  "Heavy rain\0"                                // 1195
+  "Light freezing rain\0"                       // 1198
+  "Moderate or heavy freezing rain\0"           // 1201
+  "Light sleet\0"                               // 1204
+  "Moderate or heavy sleet\0"                   // 1207
+  "Patchy light snow\0"                         // 1210
+  "Light snow\0"                                // 1213
+  "Patchy moderate snow\0"                      // 1216
+  "Moderate snow\0"                             // 1219
+  "Patchy heavy snow\0"                         // 1222
+  "Heavy snow\0"                                // 1225
+  "Ice pellets\0"                               // 1237
+  "Light rain shower\0"                         // 1240
+  "Moderate or heavy rain shower\0"             // 1243
+  "Torrential rain shower\0"                    // 1246
+  "Light sleet showers\0"                       // 1249
+  "Moderate or heavy sleet showers\0"           // 1252
+  "Light snow showers\0"                        // 1255
+  "Moderate or heavy snow showers\0"            // 1258
+  "Light showers of ice pellets\0"              // 1261
+  "Moderate or heavy showers of ice pellets\0"  // 1264
+  "Patchy light rain with thunder\0"            // 1273
+  "Moderate or heavy rain with thunder\0"       // 1276
+  "Patchy light snow with thunder\0"            // 1279
+  "Moderate or heavy snow with thunder\0";      // 1282
+
+// Code 1000 is the only condition with a different text at night
+static const char APW_conditionNight[] PROGMEM = "Clear";
@@ -0,0 +1,217 @@
+// Daily history store for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+
+#include "APW_History.h"
+
+/***************************************************************************************
+** Function name:           add
+** Description:             Append a day to the column files
+***************************************************************************************/
+// The values are written before the date, so a day cut short by a reset is not
+// counted and is written over by the next add()
+bool APW_History::add(const APW_day_compact &day)
+{
+  uint32_t days = count();
+
+  if (days)
+  {
+    File dates = fs.open(path('d'), "r");
+    if (!dates) return false;
+    uint32_t last = dateAt(dates, days - 1);
+    dates.close();
+    if (day.date_epoch <= last) return false;
+  }
+
+  return writeValue('x', days, &day.maxtemp,     sizeof(day.maxtemp))  &&
+         writeValue('n', days, &day.mintemp,     sizeof(day.mintemp))  &&
+         writeValue('p', days, &day.totalprecip, sizeof(day.totalprecip)) &&
+         writeValue('d', days, &day.date_epoch,  sizeof(day.date_epoch));
+}
+
+/***************************************************************************************
+** Function name:           count
+** Description:             Number of days stored
+***************************************************************************************/
+uint32_t APW_History::count(void)
+{
+  if (!fs.exists(path('d'))) return 0;
+
+  File dates = fs.open(path('d'), "r");
+  if (!dates) return 0;
+
+  uint32_t days = dates.size() / sizeof(uint32_t);
+  dates.close();
+
+  return days;
+}
+
+/***************************************************************************************
+** Function name:           read
+** Description:             Read the values of a stored day
+***************************************************************************************/
+bool APW_History::read(uint32_t index, APW_day_compact *day)
+{
+  if (index >= count()) return false;
+
+  *day = APW_day_compact();
+
+  File f = fs.open(path('d'), "r");
+  if (!f) return false;
+  day->date_epoch = dateAt(f, index);
+  f.close();
+
+  // The values are in the same order in each file
+  const char column[] = { 'x', 'n', 'p' };
+  void *value[] = { &day->maxtemp, &day->mintemp, &day->totalprecip };
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    f = fs.open(path(column[i]), "r");
+    if (!f) return false;
+    f.seek(index * sizeof(int16_t));
+    f.read((uint8_t *)value[i], sizeof(int16_t));
+    f.close();
+  }
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           summary
+** Description:             Summarise the days stored in a date range
+***************************************************************************************/
+// The range is found with two binary searches of the date file, then only the values
+// in the range are read from each value file, HISTORY_BLOCK values at a time
+bool APW_History::summary(uint32_t from_epoch, uint32_t to_epoch, APW_history_summary *summary)
+{
+  *summary = APW_history_summary();
+
+  if (!fs.exists(path('d'))) return true;
+
+  File dates = fs.open(path('d'), "r");
+  if (!dates) return false;
+
+  uint32_t days  = dates.size() / sizeof(uint32_t);
+  uint32_t first = search(dates, days, from_epoch, true);
+  uint32_t last  = search(dates, days, to_epoch, false);
+
+  if (first >= last) { dates.close(); return true; }
+
+  summary->days        = last - first;
+  summary->first_epoch = dateAt(dates, first);
+  summary->last_epoch  = dateAt(dates, last - 1);
+  dates.close();
+
+  int32_t low, high;
+  int64_t sum;
+
+  if (!scan('x', true, first, last, low, high, sum)) return false;
+  summary->maxtemp      = high;
+  summary->mean_maxtemp = sum / (int32_t)summary->days;
+
+  if (!scan('n', true, first, last, low, high, sum)) return false;
+  summary->mintemp      = low;
+  summary->mean_mintemp = sum / (int32_t)summary->days;
+
+  if (!scan('p', false, first, last, low, high, sum)) return false;
+  summary->totalprecip  = sum;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           writeValue
+** Description:             Write a value of a column file at an index
+***************************************************************************************/
+bool APW_History::writeValue(char column, uint32_t index, const void *value, size_t size)
+{
+  String name = path(column);
+
+  // "r+" so a value left by a day cut short is written over
+  File f = fs.exists(name) ? fs.open(name, "r+") : fs.open(name, "w");
+  if (!f) return false;
+
+  bool ok = f.seek(index * size) && (f.write((const uint8_t *)value, size) == size);
+  f.close();
+
+  return ok;
+}
+
+/***************************************************************************************
+** Function name:           dateAt, search
+** Description:             Find the days in the date file
+***************************************************************************************/
+uint32_t APW_History::dateAt(File &dates, uint32_t index)
+{
+  uint32_t epoch = 0;
+
+  dates.seek(index * sizeof(uint32_t));
+  dates.read((uint8_t *)&epoch, sizeof(epoch));
+
+  return epoch;
+}
+
+// The dates are in order, so a year of days is found in 9 reads
+uint32_t APW_History::search(File &dates, uint32_t days, uint32_t epoch, bool at)
+{
+  uint32_t low = 0, high = days;
+
+  while (low < high)
+  {
+    uint32_t mid = low + (high - low) / 2;
+    uint32_t date = dateAt(dates, mid);
+    if (date < epoch || (!at && date == epoch)) low = mid + 1;
+    else high = mid;
+  }
+
+  return low;
+}
+
+/***************************************************************************************
+** Function name:           scan
+** Description:             Lowest, highest and sum of the values in a range
+***************************************************************************************/
+bool APW_History::scan(char column, bool isSigned, uint32_t first, uint32_t last,
+                       int32_t &low, int32_t &high, int64_t &sum)
+{
+  File f = fs.open(path(column), "r");
+  if (!f) return false;
+
+  f.seek(first * sizeof(int16_t));
+
+  low  = INT32_MAX;
+  high = INT32_MIN;
+  sum  = 0;
+
+  uint16_t block[HISTORY_BLOCK];
+  uint32_t left = last - first;
+
+  while (left)
+  {
+    uint16_t count = (left > HISTORY_BLOCK) ? HISTORY_BLOCK : left;
+    if (f.read((uint8_t *)block, count * sizeof(int16_t)) != count * sizeof(int16_t))
+    {
+      f.close();
+      return false;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+      int32_t value = isSigned ? (int32_t)(int16_t)block[i] : (int32_t)block[i];
+      if (value < low)  low  = value;
+      if (value > high) high = value;
+      sum += value;
+    }
+
+    left -= count;
+  }
+
+  f.close();
+
+  return true;
+}
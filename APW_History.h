@@ -0,0 +1,90 @@
+// Daily history store for the ApixuWeather library
+
+// Keeps the daily maximum and minimum temperature and total precipitation of one
+// location in a file system, e.g. LittleFS, SPIFFS or SD, so the values of months or
+// years of responses can be summarised without keeping the responses. Each value has
+// its own file of fixed size values in date order, so a summary only reads the values
+// it needs and finds the dates with a binary search of the date file. Days are only
+// ever appended, a day with a date not after the last stored day is not added.
+
+// The values are as in the compact structs, metric x 10, see Data_Point_Set.h
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_History_h
+#define APW_History_h
+
+#include <FS.h>
+
+#include "ApixuWeather.h"
+
+#ifndef HISTORY_BLOCK
+  #define HISTORY_BLOCK 64 // Values read at a time by summary()
+#endif
+
+/***************************************************************************************
+** Description:   Structure for a summary of stored days
+***************************************************************************************/
+typedef struct APW_history_summary {
+  uint32_t days = 0;          // Days stored in the range
+  uint32_t first_epoch = 0;   // Date of the first and last of those days
+  uint32_t last_epoch = 0;
+  int16_t  maxtemp = 0;       // Highest daily maximum, deg.C x 10
+  int16_t  mintemp = 0;       // Lowest daily minimum, deg.C x 10
+  int16_t  mean_maxtemp = 0;  // Mean of the daily maximums, deg.C x 10
+  int16_t  mean_mintemp = 0;  // Mean of the daily minimums, deg.C x 10
+  uint32_t totalprecip = 0;   // Sum of the daily totals, mm x 10
+} APW_history_summary;
+
+/***************************************************************************************
+** Description:   History class
+***************************************************************************************/
+class APW_History {
+
+  public:
+    // The files for the location are named from prefix, e.g. "/ny" uses "/ny.d" for
+    // the dates and "/ny.x", "/ny.n" and "/ny.p" for the values. Use one prefix per
+    // location, SPIFFS names are limited to 31 characters.
+    APW_History(fs::FS &fs, const String &prefix) : fs(fs), prefix(prefix) { }
+
+    // Append a day, e.g. forecast.day[0] after each compact getForecast(). Returns
+    // false if the date is not after the last stored day or a file cannot be written.
+    bool add(const APW_day_compact &day);
+
+    // Number of days stored
+    uint32_t count(void);
+
+    // Read the values of a stored day, index 0 is the first day stored. Only the
+    // date_epoch, maxtemp, mintemp and totalprecip are set.
+    bool read(uint32_t index, APW_day_compact *day);
+
+    // Summarise the days from from_epoch to to_epoch inclusive, returns false if the
+    // files cannot be read. summary->days is 0 if no days are stored in the range.
+    bool summary(uint32_t from_epoch, uint32_t to_epoch, APW_history_summary *summary);
+
+  private:
+
+    // Write a value of a column file at index, the file is created if needed
+    bool writeValue(char column, uint32_t index, const void *value, size_t size);
+
+    // Date of the stored day at index
+    uint32_t dateAt(File &dates, uint32_t index);
+
+    // Index of the first stored day with a date after epoch, or at epoch if at is true
+    uint32_t search(File &dates, uint32_t days, uint32_t epoch, bool at);
+
+    // Lowest, highest and sum of the values of a column from index first to last - 1
+    bool scan(char column, bool isSigned, uint32_t first, uint32_t last,
+              int32_t &low, int32_t &high, int64_t &sum);
+
+    String path(char column) { String name = prefix; name += '.'; name += column; return name; }
+
+    fs::FS &fs;
+    String  prefix;
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
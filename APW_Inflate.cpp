@@ -0,0 +1,451 @@
+// Streaming gzip/deflate decoder for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+// The Huffman decoding follows the small canonical code method of the public domain
+// tinf library by Joergen Ibsen. Each step is undone and repeated with more input if
+// the input runs out part way, so the stream can be split anywhere.
+
+#include "APW_Inflate.h"
+
+// Length and distance bases and extra bits, RFC 1951 section 3.2.5
+static const uint16_t lengthBase[29] PROGMEM = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+static const uint8_t lengthExtra[29] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+static const uint16_t distanceBase[30] PROGMEM = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+static const uint8_t distanceExtra[30] PROGMEM = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// Order of the code length code lengths in a dynamic block header
+static const uint8_t codeOrder[19] PROGMEM = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+// gzip header flags
+#define GZIP_FHCRC    0x02
+#define GZIP_FEXTRA   0x04
+#define GZIP_FNAME    0x08
+#define GZIP_FCOMMENT 0x10
+
+/***************************************************************************************
+** Function name:           begin
+** Description:             Start a new stream
+***************************************************************************************/
+void APW_Inflate::begin(Output output, void *context)
+{
+  this->output  = output;
+  this->context = context;
+
+  state       = WRAPPER;
+  position    = 0;
+  flushed     = 0;
+  total       = 0;
+  bitBuffer   = 0;
+  bitCount    = 0;
+  carryLength = 0;
+  carryIndex  = 0;
+}
+
+/***************************************************************************************
+** Function name:           write
+** Description:             Decode a block of the compressed stream
+***************************************************************************************/
+APW_Inflate::Result APW_Inflate::write(const uint8_t *data, uint16_t count)
+{
+  input = data;
+  end   = data + count;
+
+  while (state != DONE && state != FAILED)
+  {
+    // Checkpoint so a step can be undone if the input runs out
+    uint32_t       savedBuffer = bitBuffer;
+    uint8_t        savedCount  = bitCount;
+    uint8_t        savedIndex  = carryIndex;
+    const uint8_t *savedInput  = input;
+
+    starved = false;
+    if (step()) continue;
+    if (state == FAILED) break;
+
+    // Out of input, undo the step and carry the unused bytes to the next write(). A
+    // step never needs more than the carry buffer holds.
+    bitBuffer  = savedBuffer;
+    bitCount   = savedCount;
+    carryIndex = savedIndex;
+    input      = savedInput;
+
+    uint8_t n = 0;
+    while (carryIndex < carryLength) carry[n++] = carry[carryIndex++];
+    while (input < end && n < sizeof(carry)) carry[n++] = *input++;
+    carryLength = n;
+    carryIndex  = 0;
+    break;
+  }
+
+  flush();
+
+  if (state == DONE)   return INFLATE_DONE;
+  if (state == FAILED) return INFLATE_ERROR;
+  return INFLATE_MORE;
+}
+
+/***************************************************************************************
+** Function name:           step
+** Description:             Decode one header field, symbol or copy
+***************************************************************************************/
+// Returns false if the input ran out or the stream is invalid (state is then FAILED).
+// Nothing is changed until all the bits for the step have been read.
+bool APW_Inflate::step(void)
+{
+  switch (state) {
+
+    case WRAPPER:
+    {
+      uint8_t b0 = bits(8);
+      uint8_t b1 = bits(8);
+      if (starved) return false;
+
+      if (b0 == 0x1F && b1 == 0x8B)
+      {
+        // gzip: method, flags, time, extra flags and OS follow
+        uint8_t method = bits(8);
+        uint8_t flag   = bits(8);
+        for (uint8_t i = 0; i < 6; i++) bits(8);
+        if (starved) return false;
+        if (method != 8) { state = FAILED; return false; }
+        flags   = flag;
+        trailer = 8; // CRC32 and size, not checked
+        state   = GZIP_EXTRA;
+      }
+      else if ((b0 & 0x0F) == 8 && ((b0 << 8) | b1) % 31 == 0)
+      {
+        // zlib, a preset dictionary or a window larger than ours is not supported
+        if (b1 & 0x20) { state = FAILED; return false; }
+        if ((256UL << (b0 >> 4)) > size) { state = FAILED; return false; }
+        trailer = 4; // Adler32, not checked
+        state   = BLOCK;
+      }
+      else
+      {
+        // Raw deflate, put the two bytes back
+        bitBuffer = b0 | (b1 << 8) | (bitBuffer << 16);
+        bitCount += 16;
+        trailer = 0;
+        state   = BLOCK;
+      }
+      return true;
+    }
+
+    case GZIP_EXTRA:
+      if (flags & GZIP_FEXTRA)
+      {
+        uint16_t length = bits(16);
+        if (starved) return false;
+        flags &= ~GZIP_FEXTRA;
+        left = length;
+        if (left) state = GZIP_SKIP;
+      }
+      else state = GZIP_NAME;
+      return true;
+
+    case GZIP_SKIP:
+      bits(8);
+      if (starved) return false;
+      if (--left == 0) state = GZIP_NAME;
+      return true;
+
+    case GZIP_NAME:
+    case GZIP_COMMENT:
+    {
+      uint8_t flag = (state == GZIP_NAME) ? GZIP_FNAME : GZIP_FCOMMENT;
+      if (flags & flag)
+      {
+        // Zero terminated text
+        uint8_t c = bits(8);
+        if (starved) return false;
+        if (c) return true;
+      }
+      state = (state == GZIP_NAME) ? GZIP_COMMENT : GZIP_CRC;
+      return true;
+    }
+
+    case GZIP_CRC:
+      if (flags & GZIP_FHCRC) bits(16);
+      if (starved) return false;
+      state = BLOCK;
+      return true;
+
+    case BLOCK:
+    {
+      bool    last = bits(1);
+      uint8_t type = bits(2);
+      if (starved) return false;
+
+      final = last;
+      if (type == 0)
+      {
+        // Stored block starts on a byte boundary
+        bitBuffer >>= (bitCount & 7);
+        bitCount  -= (bitCount & 7);
+        state = STORED;
+      }
+      else if (type == 1) { fixedTrees(); state = SYMBOL; }
+      else if (type == 2) state = TABLE_SIZES;
+      else { state = FAILED; return false; }
+      return true;
+    }
+
+    case STORED:
+    {
+      uint16_t length  = bits(16);
+      uint16_t inverse = bits(16);
+      if (starved) return false;
+      if (length != (uint16_t)~inverse) { state = FAILED; return false; }
+      left  = length;
+      state = left ? STORED_COPY : (final ? TRAILER : BLOCK);
+      return true;
+    }
+
+    case STORED_COPY:
+    {
+      uint8_t c = bits(8);
+      if (starved) return false;
+      put(c);
+      if (--left == 0) state = final ? TRAILER : BLOCK;
+      return true;
+    }
+
+    case TABLE_SIZES:
+    {
+      uint16_t hlit  = bits(5) + 257;
+      uint16_t hdist = bits(5) + 1;
+      uint16_t hclen = bits(4) + 4;
+      if (starved) return false;
+      if (hlit > 286 || hdist > 30) { state = FAILED; return false; }
+
+      literalCount  = hlit;
+      distanceCount = hdist;
+      codeCount     = hclen;
+      memset(lengths, 0, 19);
+      left  = 0;
+      state = TABLE_CODES;
+      return true;
+    }
+
+    case TABLE_CODES:
+    {
+      uint8_t length = bits(3);
+      if (starved) return false;
+      lengths[pgm_read_byte(codeOrder + left)] = length;
+      if (++left == codeCount)
+      {
+        // The code length tree is held in the distance tree until the tables are read
+        build(distances, lengths, 19);
+        left  = 0;
+        state = TABLE_LENGTHS;
+      }
+      return true;
+    }
+
+    case TABLE_LENGTHS:
+    {
+      int16_t  symbol = decode(distances);
+      uint8_t  repeat = 0;
+      uint8_t  length = 0;
+
+      if      (symbol == 16) repeat = 3  + bits(2);
+      else if (symbol == 17) repeat = 3  + bits(3);
+      else if (symbol == 18) repeat = 11 + bits(7);
+      if (starved) return false;
+
+      if (symbol < 0 || (symbol == 16 && left == 0)) { state = FAILED; return false; }
+
+      if (symbol < 16) { length = symbol; repeat = 1; }
+      else if (symbol == 16) length = lengths[left - 1];
+
+      if (left + repeat > literalCount + distanceCount) { state = FAILED; return false; }
+      while (repeat--) lengths[left++] = length;
+
+      if (left == literalCount + distanceCount)
+      {
+        if (lengths[256] == 0) { state = FAILED; return false; } // No end of block code
+        build(literals, lengths, literalCount);
+        build(distances, lengths + literalCount, distanceCount);
+        state = SYMBOL;
+      }
+      return true;
+    }
+
+    case SYMBOL:
+    {
+      int16_t symbol = decode(literals);
+
+      if (symbol < 256)
+      {
+        if (starved) return false;
+        if (symbol < 0) { state = FAILED; return false; }
+        put(symbol);
+        return true;
+      }
+
+      if (symbol == 256)
+      {
+        if (starved) return false;
+        state = final ? TRAILER : BLOCK;
+        return true;
+      }
+
+      // Length and distance pair
+      symbol -= 257;
+      if (symbol >= 29) { if (!starved) state = FAILED; return false; }
+
+      uint16_t length = pgm_read_word(lengthBase + symbol) + bits(pgm_read_byte(lengthExtra + symbol));
+      int16_t  code   = decode(distances);
+      if (code < 0 || code >= 30) { if (!starved) state = FAILED; return false; }
+
+      uint16_t distance = pgm_read_word(distanceBase + code) + bits(pgm_read_byte(distanceExtra + code));
+      if (starved) return false;
+
+      // A distance beyond the window cannot be decoded
+      if (distance > size || distance > total) { state = FAILED; return false; }
+
+      left  = length;
+      copyDistance = distance;
+      state = COPY;
+      return true;
+    }
+
+    case COPY:
+      while (left)
+      {
+        put(window[(uint16_t)(position - copyDistance) & (size - 1)]);
+        left--;
+      }
+      state = SYMBOL;
+      return true;
+
+    case TRAILER:
+    {
+      // Byte aligned check values, read but not checked
+      bitBuffer >>= (bitCount & 7);
+      bitCount  -= (bitCount & 7);
+      for (uint8_t i = 0; i < trailer; i++) bits(8);
+      if (starved) return false;
+      state = DONE;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           bits
+** Description:             Read bits from the input, least significant first
+***************************************************************************************/
+uint32_t APW_Inflate::bits(uint8_t count)
+{
+  while (bitCount < count)
+  {
+    uint8_t c;
+    if (carryIndex < carryLength) c = carry[carryIndex++];
+    else if (input < end) c = *input++;
+    else { starved = true; return 0; }
+
+    bitBuffer |= (uint32_t)c << bitCount;
+    bitCount  += 8;
+  }
+
+  uint32_t value = bitBuffer & ((1UL << count) - 1);
+  bitBuffer >>= count;
+  bitCount   -= count;
+
+  return value;
+}
+
+/***************************************************************************************
+** Function name:           decode
+** Description:             Decode a Huffman coded symbol, -1 if the code is invalid
+***************************************************************************************/
+int16_t APW_Inflate::decode(const Tree &tree)
+{
+  int16_t sum  = 0;
+  int16_t code = 0;
+  uint8_t length = 0;
+
+  // Codes of each length are consecutive, so the code is compared with the count
+  do {
+    code = 2 * code + bits(1);
+    if (++length > 15) return -1;
+    sum  += tree.counts[length];
+    code -= tree.counts[length];
+  } while (code >= 0);
+
+  return tree.symbols[sum + code];
+}
+
+/***************************************************************************************
+** Function name:           build
+** Description:             Build a Huffman tree from the code lengths
+***************************************************************************************/
+void APW_Inflate::build(Tree &tree, const uint8_t *lengths, uint16_t count)
+{
+  uint16_t offset[16];
+
+  memset(tree.counts, 0, sizeof(tree.counts));
+  for (uint16_t i = 0; i < count; i++) tree.counts[lengths[i]]++;
+  tree.counts[0] = 0;
+
+  uint16_t sum = 0;
+  for (uint8_t i = 0; i < 16; i++) { offset[i] = sum; sum += tree.counts[i]; }
+
+  for (uint16_t i = 0; i < count; i++)
+  {
+    if (lengths[i]) tree.symbols[offset[lengths[i]]++] = i;
+  }
+}
+
+/***************************************************************************************
+** Function name:           fixedTrees
+** Description:             Build the trees for a fixed Huffman block
+***************************************************************************************/
+void APW_Inflate::fixedTrees(void)
+{
+  uint16_t i = 0;
+  for (; i < 144; i++) lengths[i] = 8;
+  for (; i < 256; i++) lengths[i] = 9;
+  for (; i < 280; i++) lengths[i] = 7;
+  for (; i < 288; i++) lengths[i] = 8;
+  build(literals, lengths, 288);
+
+  for (i = 0; i < 30; i++) lengths[i] = 5;
+  build(distances, lengths, 30);
+}
+
+/***************************************************************************************
+** Function name:           put, flush
+** Description:             Store a decoded byte and pass decoded bytes to the output
+***************************************************************************************/
+void APW_Inflate::put(uint8_t c)
+{
+  window[position++] = c;
+  total++;
+  if (position == size) flush(); // Window full, output before it is overwritten
+}
+
+void APW_Inflate::flush(void)
+{
+  if (position > flushed && output) output(context, window + flushed, position - flushed);
+  if (position == size) position = 0;
+  flushed = position;
+}
@@ -0,0 +1,101 @@
+// Streaming gzip/deflate decoder for the ApixuWeather library
+
+// Decodes a gzip, zlib or raw deflate stream as the compressed bytes arrive, the
+// input can be split anywhere. Decoded bytes are kept only in a window of a fixed
+// size set by the sketch, and are passed to an output function each time the window
+// fills and at the end of each write(). A stream that refers back further than the
+// window fails with INFLATE_ERROR, the window must be 32768 bytes to decode any
+// stream, smaller windows work if the encoder did not use long distances. A zlib
+// stream that declares a larger window than ours fails at once.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_Inflate_h
+#define APW_Inflate_h
+
+#include <Arduino.h>
+
+/***************************************************************************************
+** Description:   Inflate class
+***************************************************************************************/
+class APW_Inflate {
+
+  public:
+    // Called with decoded bytes, count is never more than the window size
+    typedef void (*Output)(void *context, const uint8_t *data, uint16_t count);
+
+    enum Result : uint8_t { INFLATE_MORE, INFLATE_DONE, INFLATE_ERROR };
+
+    // window must be windowSize bytes, a power of 2, and remain allocated
+    APW_Inflate(uint8_t *window, uint16_t windowSize) : window(window), size(windowSize) { }
+
+    // Start a new stream, the gzip or zlib header is detected, otherwise raw deflate
+    void begin(Output output, void *context);
+
+    // Decode a block of the stream, returns INFLATE_MORE until the end of the stream
+    Result write(const uint8_t *data, uint16_t count);
+
+    // Decoded bytes so far
+    uint32_t decoded(void) { return total; }
+
+  private:
+
+    typedef struct Tree {
+      uint16_t counts[16];  // Number of codes of each length
+      uint16_t symbols[288];// Symbols ordered by code
+    } Tree;
+
+    // Decoder states, each step of a state either completes or is undone and waits
+    // for more input
+    enum : uint8_t { WRAPPER, GZIP_EXTRA, GZIP_SKIP, GZIP_NAME, GZIP_COMMENT, GZIP_CRC,
+                     BLOCK, STORED, STORED_COPY, TABLE_SIZES, TABLE_CODES, TABLE_LENGTHS,
+                     SYMBOL, COPY, TRAILER, DONE, FAILED };
+
+    bool     step(void);                     // Do one step, false if out of input
+    uint32_t bits(uint8_t count);            // Read bits, sets starved if not available
+    int16_t  decode(const Tree &tree);       // Decode a symbol, -1 if invalid
+    void     build(Tree &tree, const uint8_t *lengths, uint16_t count);
+    void     fixedTrees(void);
+    void     put(uint8_t c);                 // Store a decoded byte in the window
+    void     flush(void);                    // Pass the window bytes not yet output
+
+    uint8_t *window;
+    uint16_t size;
+    uint16_t position = 0;   // Next window position
+    uint16_t flushed  = 0;   // Window position of the first byte not yet output
+    uint32_t total    = 0;   // Bytes decoded
+
+    Output   output  = nullptr;
+    void    *context = nullptr;
+
+    uint8_t  state   = WRAPPER;
+    uint8_t  flags   = 0;     // gzip header flags
+    uint8_t  trailer = 0;     // Check value bytes after the data, gzip 8, zlib 4
+    bool     final   = false; // Last block
+    uint16_t left    = 0;     // Bytes or codes left in the current state
+    uint16_t copyDistance = 0;
+
+    // Input, bytes carried over from the last write() are read first
+    uint32_t bitBuffer = 0;
+    uint8_t  bitCount  = 0;
+    uint8_t  carry[16];
+    uint8_t  carryLength = 0;
+    uint8_t  carryIndex  = 0;
+    const uint8_t *input = nullptr;
+    const uint8_t *end   = nullptr;
+    bool     starved = false;
+
+    // Huffman trees, dynamic table code lengths
+    Tree     literals;
+    Tree     distances;
+    uint8_t  lengths[288 + 32];
+    uint16_t literalCount  = 0;
+    uint16_t distanceCount = 0;
+    uint16_t codeCount     = 0;
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
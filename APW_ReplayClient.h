@@ -0,0 +1,185 @@
+// Replay transport for the ApixuWeather library
+
+// An Arduino Client that serves a recorded server response held in RAM, PROGMEM or
+// any Arduino Stream (e.g. a SPIFFS or SD File) instead of a network connection.
+// Pass to Apixu_Weather::setClient() to run the complete request and parse loop
+// without a network, the request text written by the library is discarded.
+
+// setLink() makes the replay behave like a slow network link, so the request loop can
+// be measured with first byte latency, limited bandwidth, data arriving in packets and
+// stalls part way through the response.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_ReplayClient_h
+#define APW_ReplayClient_h
+
+#include <Arduino.h>
+#include <Client.h>
+
+/***************************************************************************************
+** Description:   Replay client class
+***************************************************************************************/
+class APW_ReplayClient : public Client {
+
+  public:
+    // Replay a null terminated message held in RAM or PROGMEM
+    APW_ReplayClient(PGM_P message) : message(message), stream(nullptr) { }
+
+    // Replay a message of a known length, e.g. a compressed response containing zeros
+    APW_ReplayClient(PGM_P message, uint32_t length)
+      : message(message), stream(nullptr), length(length), sized(true) { }
+
+    // Replay the content of a Stream e.g. a File, the stream is read once
+    APW_ReplayClient(Stream &stream) : message(nullptr), stream(&stream) { }
+
+    // Simulate a network link: latency_ms before the first byte, rate bytes per second
+    // (0 = no limit), data arriving in whole packets of packet bytes (0 = any size) and
+    // for each request a random stall of up to stall_ms at a random point in the message
+    // (0 = no stalls). Call with no parameters for no link delays (default).
+    void setLink(uint32_t latency_ms = 0, uint32_t rate = 0, uint16_t packet = 0, uint32_t stall_ms = 0)
+    {
+      latency = latency_ms * 1000UL;
+      this->rate = rate;
+      this->packet = packet;
+      stallMax = stall_ms;
+    }
+
+    // Start the replay from the beginning of the message, host and port are ignored
+    int connect(IPAddress ip, uint16_t port) { return open(); }
+    int connect(const char *host, uint16_t port) { return open(); }
+
+    // Request text written by the library is counted then discarded
+    size_t write(uint8_t c) { written++; return 1; }
+    size_t write(const uint8_t *buf, size_t size) { written += size; return size; }
+
+    int available()
+    {
+      if (!active) return 0;
+      if (stream && !linked()) return stream->available();
+
+      uint32_t count = arrived() - position;
+      if (stream && count > (uint32_t)stream->available()) count = stream->available();
+      return count;
+    }
+
+    int read()
+    {
+      uint8_t c;
+      return (read(&c, 1) == 1) ? c : -1;
+    }
+
+    // Block read, returns the number of bytes copied or -1 if none are available
+    int read(uint8_t *buf, size_t size)
+    {
+      int count = available();
+      if (count <= 0) return -1;
+      if ((size_t)count > size) count = size;
+
+      if (stream)
+      {
+        count = stream->readBytes((char *)buf, count);
+        position += count;
+        return count;
+      }
+
+      // memcpy_P works for both RAM and PROGMEM addresses
+      memcpy_P(buf, message + position, count);
+      position += count;
+      return count;
+    }
+
+    int peek()
+    {
+      if (available() <= 0) return -1;
+      if (stream) return stream->peek();
+      return pgm_read_byte(message + position);
+    }
+
+    void flush() { }
+
+    void stop() { active = false; }
+
+    // Connected until the whole message has been read
+    uint8_t connected()
+    {
+      if (!active) return 0;
+      if (stream) return stream->available() > 0;
+      return position < length;
+    }
+
+    operator bool() { return active; }
+
+    // Number of request bytes the library has written since the last connect
+    uint32_t requestLength(void) { return written; }
+
+    using Print::write;
+
+  private:
+
+    int open(void)
+    {
+      active   = true;
+      position = 0;
+      written  = 0;
+      if (message && !sized) length = strlen_P(message);
+      else if (stream) length = stream->available(); // Known once the replay starts
+
+      opened   = micros();
+      stallAt  = stallMax ? random(length) : 0;
+      stallFor = stallMax ? random(stallMax * 1000UL) : 0;
+      return 1;
+    }
+
+    // True if setLink() has set any link delays
+    bool linked(void) { return latency || rate || packet || stallMax; }
+
+    // Bytes that have arrived over the simulated link since connect
+    uint32_t arrived(void)
+    {
+      if (!linked()) return length;
+
+      uint32_t t = micros() - opened;
+      if (t < latency) return 0;
+      t -= latency;
+
+      // Arrival time of the stall point, the stall holds back the rest of the message
+      uint32_t stallTime = rate ? (uint64_t)stallAt * 1000000UL / rate : 0;
+      if (stallFor && t >= stallTime)
+      {
+        if (t < stallTime + stallFor) t = stallTime;
+        else t -= stallFor;
+      }
+
+      uint32_t count = rate ? (uint64_t)rate * t / 1000000UL : length;
+      if (stallFor && t == stallTime) count = stallAt;
+
+      // Only whole packets have arrived, except for the last
+      if (packet && count < length) count -= count % packet;
+
+      return count < length ? count : length;
+    }
+
+    PGM_P    message;        // Message in RAM or PROGMEM, nullptr if a Stream is used
+    Stream  *stream;         // Stream to replay, nullptr if a message is used
+    uint32_t length   = 0;   // Message length
+    uint32_t position = 0;   // Next character to read
+    uint32_t written  = 0;   // Count of request bytes written
+    bool     active   = false;
+    bool     sized    = false; // Length set by the sketch
+
+    // Link simulation, set by setLink()
+    uint32_t latency  = 0;   // us before the first byte
+    uint32_t rate     = 0;   // bytes per second, 0 = no limit
+    uint16_t packet   = 0;   // bytes per packet, 0 = no packets
+    uint32_t stallMax = 0;   // Longest stall in ms, 0 = no stalls
+    uint32_t opened   = 0;   // micros() at connect
+    uint32_t stallAt  = 0;   // Message position of the stall for this request
+    uint32_t stallFor = 0;   // us the stall lasts
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
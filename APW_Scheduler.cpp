@@ -0,0 +1,121 @@
+// Adaptive refresh scheduler for the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+
+#include "APW_Scheduler.h"
+
+/***************************************************************************************
+** Function name:           fetched
+** Description:             Learn from a successful fetch and set the next fetch time
+***************************************************************************************/
+// New values are expected SCHEDULE_MARGIN seconds after last_updated_epoch plus the
+// update interval. A fetch that finds no new values was early, it is retried after
+// SCHEDULE_RETRY seconds, doubled each time, up to half the interval.
+void APW_Scheduler::fetched(APW_current *current)
+{
+  setClock(current->localtime_epoch);
+  fetches++;
+
+  uint32_t lastUpdated = current->last_updated_epoch;
+
+  if (updated && lastUpdated <= updated)
+  {
+    unchanged++;
+    uint32_t retry = (uint32_t)SCHEDULE_RETRY << (retries < 6 ? retries : 6);
+    if (retry > updateInterval / 2) retry = updateInterval / 2;
+    retries++;
+    next = now() + retry;
+    return;
+  }
+
+  // The time between updates seen on consecutive fetches is the interval, or a multiple
+  // of it if updates were missed. A shorter time is taken at once. A longer time is a
+  // single interval if an early fetch found no update since the last, otherwise it
+  // only moves the interval slowly so a missed update does not double it
+  if (updated)
+  {
+    uint32_t seen = lastUpdated - updated;
+    if (seen < updateInterval) updateInterval = seen < SCHEDULE_RETRY ? SCHEDULE_RETRY : seen;
+    else if (retries) updateInterval += (seen - updateInterval) / 2;
+    else if (seen < 2 * updateInterval) updateInterval += (seen - updateInterval) / 8;
+  }
+
+  updated = lastUpdated;
+  retries = 0;
+  next = updated + updateInterval + SCHEDULE_MARGIN;
+
+  // Update overdue, e.g. the first fetch, try again soon
+  if (next <= now()) next = now() + SCHEDULE_RETRY;
+}
+
+/***************************************************************************************
+** Function name:           failed
+** Description:             Delay the next fetch after a failure
+***************************************************************************************/
+// The back off doubles with each failure in a row up to SCHEDULE_BACKOFF and is
+// randomised between half and all of that, so nodes that failed together do not
+// all retry together
+void APW_Scheduler::failed(void)
+{
+  if (!clockEpoch) setClock(1); // No server time yet, count from now
+
+  failures++;
+
+  uint32_t backoff = (uint32_t)SCHEDULE_RETRY << (retries < 6 ? retries : 6);
+  if (backoff > SCHEDULE_BACKOFF) backoff = SCHEDULE_BACKOFF;
+  retries++;
+
+  next = now() + backoff / 2 + random(backoff / 2 + 1);
+}
+
+/***************************************************************************************
+** Function name:           secondsUntil
+** Description:             Seconds until the next fetch is due
+***************************************************************************************/
+uint32_t APW_Scheduler::secondsUntil(void)
+{
+  uint32_t t = now();
+
+  if (!next || next <= t) return 0;
+
+  return next - t;
+}
+
+/***************************************************************************************
+** Function name:           sleepSeconds, wake
+** Description:             Keep the clock running over a deep sleep
+***************************************************************************************/
+// millis() restarts after a deep sleep, so the server time at the start of the sleep
+// is kept and the time slept is added to it on the wake
+uint32_t APW_Scheduler::sleepSeconds(void)
+{
+  sleepAt = now();
+  return secondsUntil();
+}
+
+void APW_Scheduler::wake(uint32_t slept_seconds)
+{
+  if (sleepAt) setClock(sleepAt + slept_seconds);
+  sleepAt = 0;
+}
+
+/***************************************************************************************
+** Function name:           now, setClock
+** Description:             Server time estimated from millis()
+***************************************************************************************/
+uint32_t APW_Scheduler::now(void)
+{
+  if (!clockEpoch) return 0;
+
+  return clockEpoch + (millis() - clockMillis) / 1000;
+}
+
+void APW_Scheduler::setClock(uint32_t epoch)
+{
+  clockEpoch  = epoch;
+  clockMillis = millis();
+}
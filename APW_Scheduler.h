@@ -0,0 +1,88 @@
+// Adaptive refresh scheduler for the ApixuWeather library
+
+// The server publishes new values for a location at a regular interval, about every
+// 15 minutes. A fetch before that only returns the same last_updated_epoch. The
+// scheduler learns the interval from the last_updated_epoch values seen and gives the
+// time of the next fetch that will find new values, so the radio is only woken when
+// it is worth it. Failed fetches are retried with a growing, randomised back off.
+
+// One scheduler is used per location. The state is a few numbers, so the scheduler
+// can be kept in RTC memory over a deep sleep, see sleepSeconds() and wake().
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef APW_Scheduler_h
+#define APW_Scheduler_h
+
+#include "ApixuWeather.h"
+
+#ifndef SCHEDULE_INTERVAL
+  #define SCHEDULE_INTERVAL 900  // Seconds between server updates until one is measured
+#endif
+
+#ifndef SCHEDULE_MARGIN
+  #define SCHEDULE_MARGIN   60   // Seconds allowed after an update for it to be published
+#endif
+
+#ifndef SCHEDULE_RETRY
+  #define SCHEDULE_RETRY    60   // Seconds before the first retry, doubled on each retry
+#endif
+
+#ifndef SCHEDULE_BACKOFF
+  #define SCHEDULE_BACKOFF  3600 // Longest time between retries after failed fetches
+#endif
+
+/***************************************************************************************
+** Description:   Scheduler class
+***************************************************************************************/
+class APW_Scheduler {
+
+  public:
+    // Record a successful fetch, the values are used to learn the update interval and
+    // to set the clock to the server time
+    void fetched(APW_current *current);
+
+    // Record a failed fetch, the next fetch is delayed by the back off time
+    void failed(void);
+
+    // True if a fetch is due now
+    bool due(void) { return secondsUntil() == 0; }
+
+    // Seconds until the next fetch is due, 0 if it is due now
+    uint32_t secondsUntil(void);
+
+    // Seconds to sleep until the next fetch is due, for a deep sleep. The scheduler
+    // must be kept in RTC memory and wake() called with the time slept after the wake.
+    uint32_t sleepSeconds(void);
+    void     wake(uint32_t slept_seconds);
+
+    // Server time now, estimated from the last fetch, 0 if there has been no fetch
+    uint32_t now(void);
+
+    // Learned seconds between server updates
+    uint32_t interval(void) { return updateInterval; }
+
+    // Counters, successful fetches, fetches that found no new values and failures
+    uint32_t fetches   = 0;
+    uint32_t unchanged = 0;
+    uint32_t failures  = 0;
+
+  private:
+
+    // Set the clock to a server time
+    void setClock(uint32_t epoch);
+
+    uint32_t updated        = 0;                 // last_updated_epoch of the last fetch
+    uint32_t updateInterval = SCHEDULE_INTERVAL; // Learned seconds between updates
+    uint32_t next           = 0;                 // Server time of the next fetch, 0 = now
+    uint32_t clockEpoch     = 0;                 // Server time at clockMillis
+    uint32_t clockMillis    = 0;                 // millis() when the clock was set
+    uint32_t sleepAt        = 0;                 // Server time when the sleep started
+    uint8_t  retries        = 0;                 // Fetches in a row that were retried
+};
+
+/***************************************************************************************
+***************************************************************************************/
+#endif
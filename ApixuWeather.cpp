@@ -18,9 +18,12 @@
 
 #include <JSON_Listener.h>
 #include <JSON_Decoder.h>
+#include <new>
 
 #include "ApixuWeather.h"
 
+#include "APW_Conditions.h"
+
 
 /***************************************************************************************
 ** Function name:           getForecast
@@ -28,190 +31,1063 @@
 ***************************************************************************************/
 // The structures etc are created by the sketch and passed to this function.
 // Pass a nullptr for current, hourly or forecast pointers to exclude in response.
+// This blocks until the response is parsed, see beginForecast() for the
+// non-blocking alternative.
 bool Apixu_Weather::getForecast(APW_current *current, APW_forecast *forecast,
                              String api_key, String city)
 {
-  data_set = "";
+  if (!beginForecast(current, forecast, api_key, city)) return false;
+
+  while (poll() < APW_DONE) yield();
+
+  return (state == APW_DONE);
+}
+
+/***************************************************************************************
+** Function name:           beginForecast
+** Description:             Start a non-blocking forecast request, completed by poll()
+***************************************************************************************/
+// The structures must not be deleted by the sketch until poll() returns APW_DONE or
+// APW_FAILED, they are filled incrementally as the response is parsed.
+bool Apixu_Weather::beginForecast(APW_current *current, APW_forecast *forecast,
+                                  String api_key, String city)
+{
+  if (busy()) return false; // Only one request at a time
+
+  data_set = NO_SET;
   forecast_index = 0;
 
   // Local copies of structure pointers, the structures are filled during parsing
   this->current  = current;
   this->forecast = forecast;
 
+  if (current)  current->metric  = metric;
+  if (forecast) forecast->metric = metric;
+
+  currentCompact = nullptr;
+  dayCompact     = nullptr;
+
   // Fetch the current and the forecast
-  String url = "http://api.apixu.com/v1/forecast.json?key=" + api_key + "&q=" + city + "&days=" + (String)MAX_DAYS;
+  return beginRequest(forecastUrl(api_key, city, MAX_DAYS));
+}
 
-  // Send GET request and feed the parser
-  bool result = parseRequest(url);
+/***************************************************************************************
+** Function name:           beginCompact
+** Description:             Start a non-blocking forecast request for compact structures
+***************************************************************************************/
+// Called by the beginForecast() template, day points to an array of days entries
+bool Apixu_Weather::beginCompact(APW_current_compact *current, APW_day_compact *day,
+                                 uint8_t days, String api_key, String city)
+{
+  if (busy()) return false; // Only one request at a time
+
+  data_set = NO_SET;
+  forecast_index = 0;
+
+  this->current  = nullptr;
+  this->forecast = nullptr;
+
+  currentCompact = current;
+  dayCompact     = day;
+  compactDays    = days;
+
+  return beginRequest(forecastUrl(api_key, city, days));
+}
+
+/***************************************************************************************
+** Function name:           forecastUrl
+** Description:             Build the forecast request url
+***************************************************************************************/
+// Origin form, the server is named by the Host header so setServer() is followed
+String Apixu_Weather::forecastUrl(const String &api_key, const String &city, uint8_t days)
+{
+  return "/v1/forecast.json?key=" + api_key + "&q=" + city + "&days=" + (String)days;
+}
+
+/***************************************************************************************
+** Function name:           replayForecast
+** Description:             Parse a recorded forecast.json message, no network used
+***************************************************************************************/
+// Used to measure parser performance and check extracted values off-line
+bool Apixu_Weather::replayForecast(APW_current *current, APW_forecast *forecast,
+                                   PGM_P json)
+{
+  if (busy()) return false; // A request is filling the structs
+
+  data_set = NO_SET;
+  forecast_index = 0;
+
+  this->current  = current;
+  this->forecast = forecast;
+
+  if (current)  current->metric  = metric;
+  if (forecast) forecast->metric = metric;
+
+  currentCompact = nullptr;
+  dayCompact     = nullptr;
+
+  bool result = parseMessage(json);
 
-  // Null out pointers to prevent crashes
   this->current  = nullptr;
   this->forecast = nullptr;
 
   return result;
 }
 
-#ifdef ESP32 // The ESP32 and ESP8266 have different and evolving client library
-             // behaviours so there are two versions of parseRequest
+/***************************************************************************************
+** Function name:           parseForecast
+** Description:             Parse a complete forecast.json message held in RAM
+***************************************************************************************/
+bool Apixu_Weather::parseForecast(APW_current *current, APW_forecast *forecast,
+                                  const char *json, size_t length)
+{
+  if (busy()) return false; // A request is filling the structs
+
+  data_set = NO_SET;
+  forecast_index = 0;
+
+  this->current  = current;
+  this->forecast = forecast;
+
+  if (current)  current->metric  = metric;
+  if (forecast) forecast->metric = metric;
+
+  currentCompact = nullptr;
+  dayCompact     = nullptr;
+
+  bool result = parseBuffer(json, length);
+
+  this->current  = nullptr;
+  this->forecast = nullptr;
+
+  return result;
+}
 
 /***************************************************************************************
-** Function name:           parseRequest (for ESP32)
-** Description:             Fetches the JSON message and feeds to the parser
+** Function name:           replayCompact
+** Description:             Parse a recorded message into the compact structures
 ***************************************************************************************/
-bool Apixu_Weather::parseRequest(String url) {
+bool Apixu_Weather::replayCompact(APW_current_compact *current, APW_day_compact *day,
+                                  uint8_t days, PGM_P json)
+{
+  if (busy()) return false; // A request is filling the structs
+
+  data_set = NO_SET;
+  forecast_index = 0;
+
+  this->current  = nullptr;
+  this->forecast = nullptr;
+
+  currentCompact = current;
+  dayCompact     = day;
+  compactDays    = days;
+
+  bool result = parseMessage(json);
 
-  uint32_t dt = millis();
+  currentCompact = nullptr;
+  dayCompact     = nullptr;
 
-  WiFiClient client;
+  return result;
+}
+
+/***************************************************************************************
+** Function name:           parseMessage
+** Description:             Feeds a null terminated message in RAM or PROGMEM to the parser
+***************************************************************************************/
+bool Apixu_Weather::parseMessage(PGM_P json) {
+
+  if (busy()) return false;
 
   JSON_Decoder parser;
   parser.setListener(this);
 
-  const char*  host = "api.apixu.com";
+  parseOK = false;
+  captured = false;
+  skipDepth = 0;
+  statsStart();
+
+  // Copied in blocks, memcpy_P and strlen_P work for both RAM and PROGMEM addresses
+  uint32_t length = strlen_P(json);
+  uint8_t  buffer[READ_BUFFER_SIZE];
+
+  stats.body_bytes = length;
 
-  if (!client.connect(host, 80))
+  while (length && !captured)
   {
-    Serial.println("Connection failed.");
-    return false;
+    uint16_t count = (length > READ_BUFFER_SIZE) ? READ_BUFFER_SIZE : length;
+    memcpy_P(buffer, json, count);
+    parseBlock(parser, buffer, count);
+    json   += count;
+    length -= count;
+    stats.bytes += count;
   }
 
-  uint32_t timeout = millis();
-  char c = 0;
-  int ccount = 0;
-  uint32_t readCount = 0;
+  statsEnd();
+
+  parser.reset();
+
+  return parseOK;
+}
+
+/***************************************************************************************
+** Function name:           parseBuffer
+** Description:             Scan a complete JSON message in RAM
+***************************************************************************************/
+// The whole message is available, so each string is found with memchr() and copied
+// in one go, numbers and literals are passed over to the next separator, and nothing
+// is done for the characters in between. The listener calls are the same as from
+// the parser, so the values stored and the subtree skipping are unchanged. Only
+// the bracket nesting is checked, e.g. a missing colon is not reported.
+bool Apixu_Weather::parseBuffer(const char *json, size_t length)
+{
+  if (busy()) return false;
+
+  const uint8_t *buffer = (const uint8_t *)json;
+  const uint8_t *end    = buffer + length;
+
+  char     text[TEXT_LENGTH];
+  uint32_t objects = 0;     // Bit per open bracket, 1 = object, 0 = array
+  uint8_t  depth   = 0;     // Open brackets, up to 32
+  bool     isKey   = false; // The next string in an object is a key
+
   parseOK = false;
+  captured = false;
+  skipDepth = 0;
+  statsStart();
+
+  stats.body_bytes = length;
 
-  // Send GET request
-  Serial.println("\nSending GET request to api.apixu.com...");
-  client.print(String("GET ") + url + " HTTP/1.1\r\n" + "Host: " + host + "\r\n" + "Connection: close\r\n\r\n");
+  uint32_t dt = micros();
 
-  Serial.println("\nParsing JSON");
+  // The message starts at the first bracket
+  while (buffer < end && *buffer != '{' && *buffer != '[') buffer++;
+  if (buffer < end) startDocument();
 
-  // Wait for a response to arrive
-  while ( client.available() == 0 )
+  while (buffer < end && !captured)
   {
-    if ((millis() - timeout) > 4000UL)
-    {
-      parser.reset();
-      client.stop();
-      return false;
+    uint8_t c = *buffer;
+
+    switch (c) {
+      case ' ': case '\t': case '\r': case '\n': case ':':
+        buffer++;
+        break;
+
+      case ',':
+        isKey = objects & 1;
+        buffer++;
+        break;
+
+      case '{':
+      case '[':
+        if (depth == 32) { error("nested too deep"); buffer = end; break; }
+        objects = (objects << 1) | (c == '{');
+        depth++;
+        buffer++;
+        if (c == '{') { isKey = true; startObject(); }
+        else
+        {
+          startArray();
+          // A callback has started a skip, pass over the subtree
+          if (skipDepth) buffer = skipBlock(buffer, end);
+        }
+        break;
+
+      case '}':
+      case ']':
+        if (!depth || (objects & 1) != (c == '}')) { error("unexpected character"); buffer = end; break; }
+        buffer++;
+        if (c == '}') endObject();
+        else endArray();
+        objects >>= 1;
+        isKey = false;
+        if (--depth == 0) { endDocument(); buffer = end; }
+        break;
+
+      case '"':
+        // A string cut short by the end of the message is not passed on, as by the parser
+        buffer = copyString(buffer + 1, end, text);
+        if (!buffer) { buffer = end; break; }
+        if (isKey) key(text);
+        else value(text);
+        isKey = false;
+        break;
+
+      default:
+      {
+        // Number, true, false or null up to the next separator
+        const uint8_t *start = buffer;
+        while (buffer < end && *buffer != ',' && *buffer != '}' && *buffer != ']' &&
+               *buffer > ' ') buffer++;
+        if (buffer == end) break;
+        // A control character other than white space, e.g. NUL, is not valid JSON
+        if (buffer == start) { error("unexpected character"); buffer = end; break; }
+        size_t count = buffer - start;
+        if (count > TEXT_LENGTH - 1) count = TEXT_LENGTH - 1;
+        memcpy(text, start, count);
+        text[count] = 0;
+        value(text);
+      }
     }
-    yield();
   }
 
-  // Parse the JSON data, the JSON_Decoder drops header characters until first '{'
-  // Using client.connected() here can make the ESP32 WiFiClient library hang
-  while(client.available() > 0)
+  stats.parse_us = micros() - dt;
+  stats.bytes = buffer - (const uint8_t *)json;
+
+  statsEnd();
+
+  return parseOK;
+}
+
+/***************************************************************************************
+** Function name:           copyString
+** Description:             Copy a string from a message in RAM without the escapes
+***************************************************************************************/
+// Escapes are converted as by the parser: \uXXXX to UTF-8, others to the character.
+// Text beyond TEXT_LENGTH - 1 characters is dropped.
+const uint8_t* Apixu_Weather::copyString(const uint8_t *buffer, const uint8_t *end, char *text)
+{
+  char *out  = text;
+  char *last = text + TEXT_LENGTH - 1;
+
+  while (buffer < end)
   {
-    c = client.read();
-    parser.parse(c);
-#ifdef SHOW_JSON
-    if (c == '{' || c == '[' || c == '}' || c == ']') Serial.println();
-    Serial.print(c); if (ccount++ > 100 && c == ',') {ccount = 0; Serial.println();}
+    // Copy up to the next quote or escape in one go
+    const uint8_t *quote = (const uint8_t *)memchr(buffer, '"', end - buffer);
+    if (!quote) quote = end;
+    const uint8_t *escape = (const uint8_t *)memchr(buffer, '\\', quote - buffer);
+    const uint8_t *stop = escape ? escape : quote;
+
+    size_t count = stop - buffer;
+    if (count > (size_t)(last - out)) count = last - out;
+    memcpy(out, buffer, count);
+    out += count;
+
+    if (!escape) { *out = 0; return (quote < end) ? quote + 1 : nullptr; }
+
+    // The escaped quote is not a closing quote, so search again after the escape
+    buffer = escape + 1;
+    if (buffer == end) break;
+
+    char c = *buffer++;
+    uint16_t u = 0;
+    switch (c) {
+      case 'b': c = '\b'; break;
+      case 'f': c = '\f'; break;
+      case 'n': c = '\n'; break;
+      case 'r': c = '\r'; break;
+      case 't': c = '\t'; break;
+      case 'u':
+        for (uint8_t i = 0; i < 4 && buffer < end; i++)
+        {
+          uint8_t h = *buffer++;
+          u = (u << 4) | (h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10);
+        }
+        if (u < 0x80) { c = u; break; }
+        // Two or three UTF-8 bytes, the last is stored below
+        if (u < 0x800) { if (out < last) *out++ = 0xC0 | (u >> 6); }
+        else
+        {
+          if (out < last) *out++ = 0xE0 | (u >> 12);
+          if (out < last) *out++ = 0x80 | ((u >> 6) & 0x3F);
+        }
+        c = 0x80 | (u & 0x3F);
+        break;
+    }
+    if (out < last) *out++ = c;
+  }
+
+  *out = 0;
+
+  return nullptr;
+}
+
+/***************************************************************************************
+** Function name:           statsStart, statsEnd
+** Description:             Bracket a request or parse to collect the statistics
+***************************************************************************************/
+void Apixu_Weather::statsStart(void)
+{
+  stats = APW_stats();
+  stats.heap_start = stats.heap_min = ESP.getFreeHeap();
+  stats.total_us = micros();
+}
+
+void Apixu_Weather::statsEnd(void)
+{
+  stats.total_us = micros() - stats.total_us;
+  stats.heap_end = ESP.getFreeHeap();
+  if (stats.heap_end < stats.heap_min) stats.heap_min = stats.heap_end;
+}
+
+/***************************************************************************************
+** Function name:           printStats
+** Description:             Print the statistics for the last request or parse
+***************************************************************************************/
+void Apixu_Weather::printStats(void)
+{
+  Serial.print("\nResult "); Serial.print(stats.error);
+  Serial.print(" in ");       Serial.print(stats.total_us / 1000); Serial.println(" ms");
+  Serial.print("connect us ");    Serial.print(stats.connect_us);
+  Serial.print(stats.reused ? " (kept alive)" : "");
+  Serial.print(", first byte us "); Serial.print(stats.first_byte_us);
+  Serial.print(", parse us ");      Serial.print(stats.parse_us);
+  Serial.print(", callback us ");   Serial.println(stats.callback_us);
+  Serial.print("bytes ");    Serial.print(stats.bytes);
+  Serial.print(", header "); Serial.print(stats.header_bytes);
+  Serial.print(", body ");   Serial.print(stats.body_bytes);
+  Serial.print(", skipped ");  Serial.println(stats.skipped);
+  Serial.print("keys ");     Serial.print(stats.keys);
+  Serial.print(", values "); Serial.print(stats.values);
+  Serial.print(", stores "); Serial.println(stats.stores);
+  Serial.print("free heap start "); Serial.print(stats.heap_start);
+  Serial.print(", min ");           Serial.print(stats.heap_min);
+  Serial.print(", end ");           Serial.println(stats.heap_end);
+}
+
+/***************************************************************************************
+** Function name:           parseRequest
+** Description:             Fetches the JSON message and feeds to the parser
+***************************************************************************************/
+// Blocking version of beginRequest() and poll()
+bool Apixu_Weather::parseRequest(String url) {
+
+  if (!beginRequest(url)) return false;
+
+  while (poll() < APW_DONE) yield();
+
+  // A message has been parsed without error but the datapoint correctness is unknown
+  return (state == APW_DONE);
+}
+
+/***************************************************************************************
+** Function name:           beginRequest
+** Description:             Start a non-blocking request, the work is done by poll()
+***************************************************************************************/
+// The transport is any Arduino Client e.g. WiFiClient, WiFiClientSecure or the
+// APW_ReplayClient, set by setClient(). A WiFiClient is used if none has been set.
+bool Apixu_Weather::beginRequest(String url) {
+
+  if (busy()) return false; // Only one request at a time
+
+  requestUrl = url;
+  if (keepAlive) lastUrl = url; // Kept to resend if the server closes the connection
+
+  // A kept alive connection on a different transport is no longer needed
+  Client *next = transport ? transport : &wifiClient;
+  if (client && client != next) client->stop();
+  client = next;
+
+  parser.reset();
+  parser.setListener(this);
+
+  parseOK = false;
+  captured = false;
+  skipDepth = 0;
+  requestError = APW_NO_ERROR;
+  state   = APW_CONNECT;
+  statsStart();
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           poll
+** Description:             Advance the request by one step, returns the new state
+***************************************************************************************/
+// Each call does a bounded amount of work: at most one connect, one write of the
+// request or one block read of READ_BUFFER_SIZE bytes, so the sketch loop can keep
+// running while a request is in progress. Note that the client connect() itself
+// blocks until the TCP connection is made or fails.
+APW_state Apixu_Weather::poll(void) {
+
+  switch (state) {
+
+    case APW_CONNECT:
+    {
+      // Reuse a kept alive connection if the server has not closed it
+      reused = keepAlive && client->connected();
+      stats.reused = reused;
+
+      uint32_t dt = micros();
+      bool connected = reused || connectClient();
+      if (!reused) stats.connect_us = micros() - dt;
+
+      if (!connected)
+      {
+#ifdef SHOW_REQUEST
+        Serial.println("Connection failed.");
+#endif
+        return finish(APW_CONNECT_FAILED);
+      }
+      state = APW_SEND;
+      break;
+    }
+
+    case APW_SEND:
+      // Send GET request
+#ifdef SHOW_REQUEST
+      Serial.print("\nSending GET request to "); Serial.print(host); Serial.println("...");
+#endif
+      client->print(String("GET ") + requestUrl + " HTTP/1.1\r\n" + "Host: " + host +
+                    (port == 80 ? String("") : ":" + String(port)) + "\r\n" +
+                    (compression ? "Accept-Encoding: gzip, deflate\r\n" : "") +
+                    (keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n"));
+      requestUrl = ""; // Free the heap, no longer needed
+
+      // Response framing is set from the header
+      headerDone    = false;
+      statusSeen    = false;
+      lineLength    = 0;
+      contentLength = 0;
+      lengthKnown   = false;
+      chunked       = false;
+      chunkState    = CHUNK_SIZE;
+      chunkLeft     = 0;
+      encoded       = false;
+      decodeFailed  = false;
+      bodyBytes     = 0;
+      documentEnded = false;
+      reuse         = keepAlive;
+
+      timeout = millis();
+      stats.first_byte_us = micros(); // Set to the wait time when a byte arrives
+      state = APW_WAIT;
+      break;
+
+    case APW_WAIT:
+      // Wait for a response to arrive
+      if (client->available() > 0)
+      {
+        stats.first_byte_us = micros() - stats.first_byte_us;
+        state = APW_PARSE;
+      }
+      else if (reused && !client->connected())
+      {
+        // Server closed the kept alive connection, reconnect and send again
+        client->stop();
+        reused = stats.reused = false;
+        uint32_t dt = micros();
+        bool connected = connectClient();
+        stats.connect_us = micros() - dt;
+        if (!connected) return finish(APW_CONNECT_FAILED);
+        requestUrl = lastUrl;
+        state = APW_SEND;
+      }
+      else if ((millis() - timeout) > responseMs) return finish(APW_RESPONSE_TIMEOUT);
+      break;
+
+    case APW_PARSE:
+      // Read in blocks so the client call is once per block, not per character
+      if (client->available() > 0)
+      {
+        uint8_t buffer[READ_BUFFER_SIZE];
+        int count = client->read(buffer, READ_BUFFER_SIZE);
+
+        if (count > 0)
+        {
+          stats.bytes += count;
+
+          // Strip the HTTP header, then feed the body to the JSON parser
+          uint16_t used = headerDone ? 0 : parseHeader(buffer, count);
+          stats.header_bytes += used;
+
+          // An error response is not parsed, the connection is closed
+          if (headerDone && stats.status && (stats.status < 200 || stats.status > 299))
+          {
+            reuse = false;
+            return finish(APW_HTTP_ERROR);
+          }
+
+          if (chunked) parseChunked(buffer + used, count - used);
+          else parseBody(buffer + used, count - used);
+          bodyBytes += count - used;
+
+          // Ask for uncompressed responses from now on, see setCompression()
+          if (decodeFailed)
+          {
+            reuse = false;
+            compression = false;
+            return finish(APW_DECODE_ERROR);
+          }
+
+          // Every field requested has been stored, the rest of the response is not
+          // needed. The connection cannot be reused as the response is not all read
+          if (captured)
+          {
+            reuse = false;
+            return finish(parseOK ? APW_NO_ERROR : APW_PARSE_ERROR);
+          }
+
+          // A Content-Length delimited or chunked response is complete when the last
+          // byte arrives, there is no wait for the server to close
+          if ((headerDone && lengthKnown && bodyBytes >= contentLength) || chunkState == CHUNK_DONE)
+            return finish(parseOK ? APW_NO_ERROR : APW_PARSE_ERROR);
+
+          // Otherwise stop at the end of the JSON document, the connection cannot be
+          // reused as the end of the response is unknown
+          if (!lengthKnown && !chunked && documentEnded)
+          {
+            reuse = false;
+            return finish(parseOK ? APW_NO_ERROR : APW_PARSE_ERROR);
+          }
+        }
+      }
+      // Without a Content-Length the response ends when the server closes
+      // The ESP32 and ESP8266 have different and evolving client library behaviours:
+      // ESP32   - using client.connected() here can make the WiFiClient library hang.
+      //           No data available is not the end of the response on a slow link, so
+      //           an unframed response ends at the end of the JSON document (above) or
+      //           fails with a timeout if it is cut short
+      // ESP8266 - connected() checked because WiFiClient can disconnect when buffer
+      //           is not empty
+#ifndef ESP32
+      else if (!client->connected())
+      {
+        // A framed response is only complete when all of it has arrived
+        if ((lengthKnown && bodyBytes < contentLength) || (chunked && chunkState != CHUNK_DONE))
+        {
+          reuse = false;
+          return finish(APW_INCOMPLETE_ERROR);
+        }
+        return finish(parseOK ? APW_NO_ERROR : APW_PARSE_ERROR);
+      }
+#endif
+
+      if ((millis() - timeout) > completeMs)
+      {
+#ifdef SHOW_REQUEST
+        Serial.println ("JSON client timeout");
 #endif
+        return finish(APW_PARSE_TIMEOUT);
+      }
+      break;
+
+    default: // APW_IDLE, APW_DONE or APW_FAILED, nothing to do
+      break;
+  }
+
+  return state;
+}
+
+/***************************************************************************************
+** Function name:           finish
+** Description:             Close the request and set the final state
+***************************************************************************************/
+APW_state Apixu_Weather::finish(APW_error result)
+{
+  stats.body_bytes = bodyBytes;
+  if (encoded && inflater) stats.decoded_bytes = inflater->decoded();
+  stats.error = result;
+  statsEnd();
+
+#ifdef SHOW_REQUEST
+  printStats();
+#endif
+
+  parser.reset();
 
-    if ((millis() - timeout) > 8000UL)
+  // Keep the connection open only if the whole response has been read, so the next
+  // response starts with the header
+  bool complete = headerDone && ((lengthKnown && (bodyBytes == contentLength)) ||
+                                 (chunkState == CHUNK_DONE));
+  if (!(reuse && complete && result == APW_NO_ERROR)) client->stop();
+  requestUrl = "";
+
+  // Null out pointers to prevent crashes
+  this->current  = nullptr;
+  this->forecast = nullptr;
+  currentCompact = nullptr;
+  dayCompact     = nullptr;
+
+  requestError = result;
+  state = (result == APW_NO_ERROR) ? APW_DONE : APW_FAILED;
+
+  return state;
+}
+
+/***************************************************************************************
+** Function name:           setClient, setServer
+** Description:             Set the transport and the server used by parseRequest
+***************************************************************************************/
+void Apixu_Weather::setClient(Client *client)
+{
+  // A connection kept on the old transport is closed while that client still exists
+  if (this->client && client != transport && !busy())
+  {
+    this->client->stop();
+    this->client = nullptr;
+  }
+
+  transport = client;
+}
+
+void Apixu_Weather::setServer(const char *host, uint16_t port)
+{
+  this->host = host;
+  this->port = port;
+
+  // Address and any kept alive connection are for the old server
+  hostResolved = false;
+  if (client) client->stop();
+}
+
+/***************************************************************************************
+** Function name:           setCompression
+** Description:             Ask the server for compressed responses
+***************************************************************************************/
+// The decoder and its window are allocated once here, not per request
+bool Apixu_Weather::setCompression(bool enable)
+{
+  if (busy()) return false;
+
+  compression = false;
+
+  // A smaller window cannot decode every response the server may send
+  if (enable && INFLATE_WINDOW < 32768) return false;
+
+  if (enable && !inflater)
+  {
+    inflateWindow = new (std::nothrow) uint8_t[INFLATE_WINDOW];
+    if (inflateWindow) inflater = new (std::nothrow) APW_Inflate(inflateWindow, INFLATE_WINDOW);
+    if (!inflater)
     {
-      //Serial.println ("JSON parse loop timeout");
-      parser.reset();
-      client.stop();
+      delete[] inflateWindow;
+      inflateWindow = nullptr;
       return false;
     }
-    yield();
+  }
+  else if (!enable && inflater)
+  {
+    delete inflater;
+    delete[] inflateWindow;
+    inflater = nullptr;
+    inflateWindow = nullptr;
   }
 
-  Serial.println("");
-  Serial.print("Done in "); Serial.print(millis()-dt); Serial.println(" ms\n");
+  compression = enable;
+  return true;
+}
 
-  parser.reset();
+/***************************************************************************************
+** Function name:           onCurrent, onForecastDay
+** Description:             Set the progressive callbacks
+***************************************************************************************/
+void Apixu_Weather::onCurrent(CurrentCallback callback, void *context)
+{
+  currentCallback = callback;
+  currentContext  = context;
+}
 
-  client.stop();
+void Apixu_Weather::onForecastDay(DayCallback callback, void *context)
+{
+  dayCallback = callback;
+  dayContext  = context;
+}
 
-  // A message has been parsed but the datapoint correctness is unknown
-  return parseOK;
+/***************************************************************************************
+** Function name:           setKeepAlive
+** Description:             Keep the connection open between requests
+***************************************************************************************/
+// Saves the DNS lookup and TCP handshake for back to back requests. The connection is
+// only reused if the server sends a Content-Length and does not close it, otherwise
+// a new connection is made transparently.
+void Apixu_Weather::setKeepAlive(bool keep)
+{
+  keepAlive = keep;
+  if (!keep) lastUrl = "";
+  if (!keep && client && !busy()) client->stop();
+}
+
+/***************************************************************************************
+** Function name:           setTimeouts
+** Description:             Set the response timeouts
+***************************************************************************************/
+void Apixu_Weather::setTimeouts(uint32_t response_ms, uint32_t complete_ms)
+{
+  responseMs = response_ms;
+  completeMs = complete_ms;
+}
+
+/***************************************************************************************
+** Function name:           connectClient
+** Description:             Connect the transport to the server
+***************************************************************************************/
+bool Apixu_Weather::connectClient(void)
+{
+  // Other transports e.g. WiFiClientSecure need the host name to connect
+  if (client != &wifiClient) return client->connect(host, port);
+
+  // Resolve the host name once and then connect by address
+  if (!hostResolved) hostResolved = WiFi.hostByName(host, hostIP);
+  if (hostResolved && client->connect(hostIP, port)) return true;
+
+  hostResolved = false; // Address may have changed, resolve again next time
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           parseHeader
+** Description:             Read the HTTP response header, returns the bytes used
+***************************************************************************************/
+// The status line is checked for the status code and the header lines for the body
+// length, chunked transfer encoding and whether the server will close the
+// connection. A response without an HTTP header e.g. a replayed JSON message, is
+// passed straight to the parser.
+uint16_t Apixu_Weather::parseHeader(const uint8_t *buffer, uint16_t count)
+{
+  uint16_t i = 0;
+
+  while (i < count)
+  {
+    char c = buffer[i++];
+
+    if (!statusSeen)
+    {
+      if (c != 'H') { headerDone = true; return 0; } // Not "HTTP/1.x"
+      statusSeen = true;
+    }
+
+    if (c == '\r') continue;
+
+    if (c != '\n')
+    {
+      // Lines longer than the buffer are truncated, only the start is checked
+      if (lineLength < sizeof(headerLine) - 1) headerLine[lineLength++] = c;
+      continue;
+    }
+
+    headerLine[lineLength] = 0;
+
+    // A blank line ends the header
+    if (lineLength == 0) { headerDone = true; break; }
+    lineLength = 0;
+
+    if (!strncasecmp(headerLine, "HTTP/1.", 7))
+    {
+      // Status line e.g. "HTTP/1.1 200 OK"
+      if (headerLine[7] == '0') reuse = false;
+      stats.status = (uint16_t)decimalToUInt(skipSpace(headerLine + 8));
+    }
+    else
+    if (!strncasecmp(headerLine, "Content-Encoding:", 17))
+    {
+      const char *coding = skipSpace(headerLine + 17);
+      encoded = !strncasecmp(coding, "gzip", 4) || !strncasecmp(coding, "deflate", 7);
+      // The gzip, zlib or raw deflate format is detected by the decoder
+      if (encoded && inflater) inflater->begin(inflateOutput, this);
+      if (encoded && !inflater) decodeFailed = true; // Compression not enabled
+    }
+    else
+    if (!strncasecmp(headerLine, "Transfer-Encoding:", 18))
+      stats.chunked = chunked = (strstr(headerLine + 18, "chunked") != nullptr);
+    else
+    if (!strncasecmp(headerLine, "Content-Length:", 15))
+    {
+      contentLength = decimalToUInt(skipSpace(headerLine + 15));
+      lengthKnown   = true; // A length of 0 is a complete empty body
+    }
+    else
+    if (!strncasecmp(headerLine, "Connection:", 11) &&
+        !strncasecmp(skipSpace(headerLine + 11), "close", 5)) reuse = false;
+  }
+
+  return i;
+}
+
+/***************************************************************************************
+** Function name:           parseChunked
+** Description:             Decode a chunked body, only the data reaches the parser
+***************************************************************************************/
+// Each chunk is a hex size line, the data and a CRLF. The chunk data is fed to the
+// parser straight from the buffer. A zero size chunk and the (normally empty) trailer
+// end the body, chunkState is then CHUNK_DONE. Chunks can span several blocks.
+void Apixu_Weather::parseChunked(const uint8_t *buffer, uint16_t count)
+{
+  const uint8_t *end = buffer + count;
+
+  while (buffer < end && chunkState != CHUNK_DONE)
+  {
+    if (chunkState == CHUNK_DATA)
+    {
+      uint32_t length = end - buffer;
+      if (length > chunkLeft) length = chunkLeft;
+      parseBody(buffer, length);
+      buffer    += length;
+      chunkLeft -= length;
+      if (!chunkLeft) chunkState = CHUNK_DATA_END;
+      continue;
+    }
+
+    char c = *buffer++;
+
+    switch (chunkState) {
+
+      case CHUNK_SIZE:
+        if      (c >= '0' && c <= '9') chunkLeft = (chunkLeft << 4) + (c - '0');
+        else if (c >= 'a' && c <= 'f') chunkLeft = (chunkLeft << 4) + (c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') chunkLeft = (chunkLeft << 4) + (c - 'A' + 10);
+        else if (c == '\n')
+        {
+          chunkState = chunkLeft ? CHUNK_DATA : CHUNK_TRAILER;
+          lineLength = 0;
+        }
+        else if (c != '\r') chunkState = CHUNK_EXTENSION; // e.g. ";name=value"
+        break;
+
+      case CHUNK_EXTENSION:
+        if (c == '\n')
+        {
+          chunkState = chunkLeft ? CHUNK_DATA : CHUNK_TRAILER;
+          lineLength = 0;
+        }
+        break;
+
+      case CHUNK_DATA_END:
+        // CRLF after the data, then the next size line
+        if (c == '\n') { chunkState = CHUNK_SIZE; chunkLeft = 0; }
+        break;
+
+      case CHUNK_TRAILER:
+        // Trailer header lines, a blank line ends the body
+        if (c == '\n')
+        {
+          if (lineLength == 0) chunkState = CHUNK_DONE;
+          lineLength = 0;
+        }
+        else if (c != '\r') lineLength = 1;
+        break;
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           parseBody, inflateOutput
+** Description:             Feed body data to the parser, decoding it if compressed
+***************************************************************************************/
+void Apixu_Weather::parseBody(const uint8_t *buffer, uint16_t count)
+{
+  if (!encoded) { parseBlock(parser, buffer, count); return; }
+
+  if (decodeFailed || !count) return;
+
+  // Decoded bytes are passed to inflateOutput() as they are produced
+  if (inflater->write(buffer, count) == APW_Inflate::INFLATE_ERROR) decodeFailed = true;
 }
 
-#else // ESP8266 version
+void Apixu_Weather::inflateOutput(void *context, const uint8_t *data, uint16_t count)
+{
+  Apixu_Weather *weather = (Apixu_Weather *)context;
+  weather->parseBlock(weather->parser, data, count);
+}
 
 /***************************************************************************************
-** Function name:           parseRequest (for ESP8266)
-** Description:             Fetches the JSON message and feeds to the parser
+** Function name:           skipSpace
+** Description:             Skip spaces at the start of a header value
 ***************************************************************************************/
-bool Apixu_Weather::parseRequest(String url) {
+const char* Apixu_Weather::skipSpace(const char *str)
+{
+  while (*str == ' ' || *str == '\t') str++;
+  return str;
+}
 
-  uint32_t dt = millis();
+/***************************************************************************************
+** Function name:           parseBlock
+** Description:             Feeds a block of received characters to the parser
+***************************************************************************************/
+// Stops early once every field requested has been captured
+void Apixu_Weather::parseBlock(JSON_Decoder &parser, const uint8_t *buffer, int count)
+{
+  if (count <= 0) return; // Client read can return -1 if nothing available
 
-  WiFiClient client;
+  uint32_t dt = micros();
 
-  JSON_Decoder parser;
-  parser.setListener(this);
+  const uint8_t *end = buffer + count;
 
-  const char*  host = "api.apixu.com";
+#ifdef SHOW_JSON
+  static int ccount = 0;
+#endif
 
-  if (!client.connect(host, 80))
+  while (buffer < end && !captured)
   {
-    Serial.println("Connection failed.");
-    return false;
-  }
+    // A callback has started a skip, pass over the subtree
+    if (skipDepth) { buffer = skipBlock(buffer, end); continue; }
 
+    char c = *buffer++;
+    parser.parse(c);
 
-  uint32_t timeout = millis();
-  char c = 0;
-  int ccount = 0;
+#ifdef SHOW_JSON
+    if (c == '{' || c == '[' || c == '}' || c == ']') Serial.println();
+    Serial.print(c); if (ccount++ > 100 && c == ',') {ccount = 0; Serial.println();}
+#endif
+  }
 
-  parseOK = false;
+  stats.parse_us += micros() - dt;
+}
 
-  // Send GET request
-  Serial.println("Sending GET request to api.apixu.com...");
-  client.print(String("GET ") + url + " HTTP/1.1\r\n" + "Host: " + host + "\r\n" + "Connection: close\r\n\r\n");
+/***************************************************************************************
+** Function name:           skipBlock
+** Description:             Pass over the characters of a skipped array or object
+***************************************************************************************/
+// The opening bracket has been parsed. Brackets are counted, ignoring any in strings,
+// until the matching closing bracket which is left for the parser, so the parser
+// sees an empty array or object. The skip can span several blocks.
+// Most characters are passed over by the inner loops, which test each character once
+// or twice: in a string only quote and backslash matter, outside only quote and the
+// brackets. Setting bit 5 folds [ \ ] onto { | } so one range test finds the brackets.
+const uint8_t* Apixu_Weather::skipBlock(const uint8_t *buffer, const uint8_t *end)
+{
+  const uint8_t *start = buffer;
 
-  Serial.println("Parsing JSON");
-  
-  // Parse the JSON data, the JSON_Decoder drops header characters until first '{'
-  // OR used because ESP8266 WiFiClientlibrary can disconnect when buffer is not empty
-  while ( (client.available() > 0 ) || client.connected())
+  while (buffer < end)
   {
-    while ( client.available() )
+    if (skipString)
     {
-      c = client.read();
-      parser.parse(c);
-  #ifdef SHOW_JSON
-      if (c == '{' || c == '[' || c == '}' || c == ']') Serial.println();
-      Serial.print(c); if (ccount++ > 100 && c == ',') {ccount = 0; Serial.println();}
-  #endif
-      yield();
-    }
+      if (skipEscape) { skipEscape = false; buffer++; continue; }
 
-    if ((millis() - timeout) > 8000UL)
+      while (buffer < end && *buffer != '"' && *buffer != '\\') buffer++;
+      if (buffer == end) break;
+
+      if (*buffer == '"') skipString = false;
+      else skipEscape = true;
+    }
+    else
     {
-      Serial.println ("JSON client timeout");
-      parser.reset();
-      client.stop();
-      return false;
+      while (buffer < end && *buffer != '"' && (uint8_t)((*buffer | 0x20) - '{') > 2) buffer++;
+      if (buffer == end) break;
+
+      uint8_t c = *buffer | 0x20;
+      if (*buffer == '"') skipString = true;
+      else if (c == '{') skipDepth++;
+      else if (c == '}')
+      {
+        if (--skipDepth == 0) break; // Matching bracket, parsed by the caller
+      }
     }
-    yield();
-  }
 
-  Serial.println("");
-  Serial.print("Done in "); Serial.print(millis()-dt); Serial.println(" ms\n");
+    buffer++;
+  }
 
-  parser.reset();
+  stats.skipped += buffer - start;
 
-  client.stop();
-  
-  // A message has been parsed without error but the datapoint correctness is unknown
-  return parseOK;
+  return buffer;
 }
 
-#endif // ESP32 or ESP8266 parseRequest
-
 /***************************************************************************************
 ** Function name:           key etc
 ** Description:             These functions are called while parsing the JSON message
 ***************************************************************************************/
 void Apixu_Weather::key(const char *key) {
 
-  currentKey = key;
+  uint32_t dt = micros();
+
+  stats.keys++;
+
+  // Hash once here so value() and startObject() dispatch with a single switch
+  uint32_t hash = 2166136261UL;
+  while (*key) hash = (hash ^ (uint8_t)*key++) * 16777619UL;
+  keyHash = hash;
+
+  stats.callback_us += micros() - dt;
 
 #ifdef SHOW_CALLBACK
   Serial.print("<<< Key <<<\n");
@@ -220,10 +1096,15 @@ void Apixu_Weather::key(const char *key) {
 
 void Apixu_Weather::startDocument() {
 
-  currentObject = currentKey = "";
+  keyHash = 0;
   objectLevel = 0;
   arrayIndex = 0;
   parseOK = true;
+  captured = false;
+  daysDone = false;
+  hourRecord = nullptr;
+  localEpoch = 0;
+  if (hourly) hourly->clear();
 
 #ifdef SHOW_CALLBACK
   Serial.print("\n>>> Start document >>>");
@@ -232,7 +1113,9 @@ void Apixu_Weather::startDocument() {
 
 void Apixu_Weather::endDocument() {
 
-  currentObject = currentKey = "";
+  documentEnded = true;
+
+  keyHash = 0;
   objectLevel = 0;
   arrayIndex = 0;
 
@@ -243,16 +1126,15 @@ void Apixu_Weather::endDocument() {
 
 void Apixu_Weather::startObject() {
 
-  if (currentKey == "location") {
-    data_set = "location";
-  }
-
-  if (currentKey == "current") {
-    data_set = "current";
-  }
-
-  if (currentKey == "forecast") {
-    data_set = "forecast";
+  switch (keyHash) {
+    case APW_hash("location"): data_set = LOCATION_SET; break;
+    case APW_hash("current"):  data_set = CURRENT_SET;  break;
+    case APW_hash("forecast"):
+      data_set = FORECAST_SET;
+      // The forecast is last in the message, without day storage only the hourly
+      // store may still be wanted, so stop here if there is none or once it is full
+      if (!forecast && !dayCompact) { daysDone = true; checkCaptured(); }
+      break;
   }
 
   objectLevel++;
@@ -264,9 +1146,22 @@ void Apixu_Weather::startObject() {
 
 void Apixu_Weather::endObject() {
 
-  currentObject = "";
+  // End of the current object, level 1 is the document
+  if (data_set == CURRENT_SET && objectLevel == 2 && currentCallback && current)
+    currentCallback(currentContext, APW_CUR_COMPLETE, current);
+
+  // End of an hour object, the record is complete
+  if (hourRecord && objectLevel == hourLevel)
+  {
+    hourRecord = nullptr;
+    checkCaptured();
+  }
+
   objectLevel--;
 
+  uint32_t heap = ESP.getFreeHeap();
+  if (heap < stats.heap_min) stats.heap_min = heap;
+
 #ifdef SHOW_CALLBACK
   Serial.print("\n<<< End object <<<");
 #endif
@@ -274,7 +1169,19 @@ void Apixu_Weather::endObject() {
 
 void Apixu_Weather::startArray() {
 
-  arrayIndex  = 0;
+  // Hourly data is only collected if there is room in the hourly store, otherwise
+  // the array content is skipped. The day index must be preserved inside the array
+  if (keyHash == APW_hash("hour"))
+  {
+    data_set = HOUR_SET;
+    if (!hourly || hourly->full())
+    {
+      skipDepth = 1;
+      skipString = false;
+      skipEscape = false;
+    }
+  }
+  else arrayIndex  = 0;
 
 #ifdef SHOW_CALLBACK
   Serial.print("\n>>> Array index " + (String) arrayIndex +" >>>");
@@ -283,7 +1190,8 @@ void Apixu_Weather::startArray() {
 
 void Apixu_Weather::endArray() {
 
-  arrayIndex  = 0;
+  if (data_set == HOUR_SET) data_set = FORECAST_SET;
+  else arrayIndex  = 0;
 
 #ifdef SHOW_CALLBACK
   Serial.print("\n<<< End array <<<");
@@ -305,38 +1213,45 @@ void Apixu_Weather::error( const char *message ) {
 ***************************************************************************************/
 uint8_t Apixu_Weather::iconIndex(uint16_t code)
 {
-  // 48 weather condition codes are listed on Apixu website
-  if ( code == 1063 || code == 1186 || code == 1189 || code == 1195 ) return 1;
-  if ( code == 1240 || code == 1243 || code == 1246 || code == 1249 ) return 1;
-  if ( code == 1192 ) return 1;
-
-  if ( code == 1069 || code == 1072 || code == 1168 || code == 1171 ) return 2;
-  if ( code == 1198 || code == 1201 || code == 1204 || code == 1207 ) return 2;
-  if ( code == 1252 ) return 2;
+  // 48 weather condition codes are listed on Apixu website, see APW_Conditions.h
+  uint8_t row = conditionRow(code);
 
-  if ( code == 1066 || code == 1114 || code == 1117 || code == 1210 ) return 3;
-  if ( code == 1213 || code == 1216 || code == 1219 || code == 1222 ) return 3;
-  if ( code == 1225 || code == 1255 || code == 1258 || code == 1282 ) return 3;
+  if (row == APW_NO_CONDITION) return NO_VALUE;
 
-  if ( code == 1000 ) return 4;
-
-  if ( code == 1003 ) return 6;
+  return pgm_read_byte(&APW_conditionIcon[row]);
+}
 
-  if ( code == 1006 || code == 1009 ) return 8;
+/***************************************************************************************
+** Function name:           conditionRow
+** Description:             Row of a condition code in the condition tables
+***************************************************************************************/
+uint8_t Apixu_Weather::conditionRow(uint16_t code)
+{
+  uint8_t slot = APW_conditionSlot(code);
 
-  if ( code == 1030 || code == 1135 || code == 1147 ) return 9;
+  if (slot == APW_NO_CONDITION) return APW_NO_CONDITION;
 
-  if ( code == 1087 || code == 1273 || code == 1276 || code == 1279 ) return 11;
+  return pgm_read_byte(&APW_slotRow[slot]);
+}
 
-  if ( code == 1150 || code == 1153 ) return 12;
+/***************************************************************************************
+** Function name:           conditionText
+** Description:             Condition text for an Apixu condition code
+***************************************************************************************/
+// The text is not copied to RAM, the pointer can be printed or used to make a String
+const __FlashStringHelper* Apixu_Weather::conditionText(uint16_t condition, bool is_day)
+{
+  uint8_t row = conditionRow(condition);
 
-  if ( code == 1180 || code == 1183 ) return 13;
+  if (row == APW_NO_CONDITION) return reinterpret_cast<const __FlashStringHelper*>(APW_noCondition);
 
-  if ( code == 1261 || code == 1264 ) return 14;
+  if (!is_day && row == 0) return reinterpret_cast<const __FlashStringHelper*>(APW_conditionNight);
 
-  if ( code == 1237 ) return 15;
+  // Step over the texts of the rows before
+  PGM_P text = APW_conditionText;
+  while (row--) text += strlen_P(text) + 1;
 
-  return NO_VALUE;
+  return reinterpret_cast<const __FlashStringHelper*>(text);
 }
 
 /***************************************************************************************
@@ -363,91 +1278,639 @@ void Apixu_Weather::setMetric(bool m)
   metric = m;
 }
 
+// Bytes saved for the current values after the location text, and for each day. The
+// unit dependant values and their alternate units values are floats like temp, and the
+// four times of a day are saved as minutes since midnight.
+#define APW_SNAP_CURRENT (sizeof(APW_current::localtime_epoch) + sizeof(APW_current::last_updated_epoch) + \
+                          sizeof(APW_current::condition) + sizeof(APW_current::is_day) + \
+                          sizeof(APW_current::code) + sizeof(APW_current::metric) + \
+                          8 * sizeof(APW_current::temp) + sizeof(APW_current::wind_degree) + \
+                          sizeof(APW_current::humidity) + sizeof(APW_current::cloud))
+#define APW_SNAP_DAY     (sizeof(APW_forecast::date_epoch[0]) + 6 * sizeof(APW_forecast::maxtemp[0]) + \
+                          sizeof(APW_forecast::condition[0]) + sizeof(APW_forecast::code[0]) + \
+                          4 * sizeof(uint16_t))
+
+static_assert(APW_SNAPSHOT_SIZE == 14 + APW_SNAP_CURRENT + 1 + 3 * LOCATION_LENGTH + APW_SNAP_DAY * MAX_DAYS,
+              "APW_SNAPSHOT_SIZE does not match the saved fields");
 
 /***************************************************************************************
-** Function name:           value (full data set)
-** Description:             Stores the parsed data in the structures for sketch access
+** Function name:           saveSnapshot
+** Description:             Save the values to a versioned and checksummed snapshot
+***************************************************************************************/
+// Layout: "APWS" magic, version, days, flags, 0, payload length (2 bytes), the current
+// values, the values for each day, then the CRC-32 of all the bytes before it. Text is
+// not saved, the condition text is restored from the condition code and the times
+// are saved as minutes since midnight.
+size_t Apixu_Weather::saveSnapshot(uint8_t *buffer, size_t size, APW_current *current, APW_forecast *forecast)
+{
+  if (!buffer || size < APW_SNAPSHOT_SIZE) return 0;
+
+  uint8_t *p = buffer;
+
+  snapPut(p, (uint32_t)0x53575041); // "APWS"
+  snapPut(p, (uint8_t)APW_SNAPSHOT_VERSION);
+  snapPut(p, (uint8_t)MAX_DAYS);
+  snapPut(p, (uint8_t)((current ? 1 : 0) | (forecast ? 2 : 0)));
+  snapPut(p, (uint8_t)0);
+  uint8_t *length = p;
+  p += 2;
+
+  if (current)
+  {
+    snapPutText(p, current->name);
+    snapPutText(p, current->region);
+    snapPutText(p, current->country);
+    snapPut(p, current->localtime_epoch);
+    snapPut(p, current->last_updated_epoch);
+    snapPut(p, current->condition);
+    snapPut(p, current->is_day);
+    snapPut(p, current->code);
+    snapPut(p, current->metric);
+    snapPut(p, current->temp);
+    snapPut(p, current->wind);
+    snapPut(p, current->pressure);
+    snapPut(p, current->precip);
+    snapPut(p, current->alt_temp);
+    snapPut(p, current->alt_wind);
+    snapPut(p, current->alt_pressure);
+    snapPut(p, current->alt_precip);
+    snapPut(p, current->wind_degree);
+    snapPut(p, current->humidity);
+    snapPut(p, current->cloud);
+  }
+
+  if (forecast)
+  {
+    snapPut(p, forecast->metric);
+    for (uint8_t i = 0; i < MAX_DAYS; i++)
+    {
+      snapPut(p, forecast->date_epoch[i]);
+      snapPut(p, forecast->maxtemp[i]);
+      snapPut(p, forecast->mintemp[i]);
+      snapPut(p, forecast->totalprecip[i]);
+      snapPut(p, forecast->alt_maxtemp[i]);
+      snapPut(p, forecast->alt_mintemp[i]);
+      snapPut(p, forecast->alt_totalprecip[i]);
+      snapPut(p, forecast->condition[i]);
+      snapPut(p, forecast->code[i]);
+      snapPut(p, timeToMinutes(forecast->sunrise[i].c_str()));
+      snapPut(p, timeToMinutes(forecast->sunset[i].c_str()));
+      snapPut(p, timeToMinutes(forecast->moonrise[i].c_str()));
+      snapPut(p, timeToMinutes(forecast->moonset[i].c_str()));
+    }
+  }
+
+  snapPut(length, (uint16_t)(p - length - 2));
+  snapPut(p, crc32(buffer, p - buffer));
+
+  return p - buffer;
+}
+
+/***************************************************************************************
+** Function name:           loadSnapshot
+** Description:             Restore the values from a snapshot made by saveSnapshot()
+***************************************************************************************/
+// The snapshot is checked before any value is copied to the structs
+bool Apixu_Weather::loadSnapshot(const uint8_t *buffer, size_t length, APW_current *current, APW_forecast *forecast)
+{
+  if (!buffer || length < 14) return false;
+
+  const uint8_t *p = buffer;
+  uint32_t magic;
+  uint8_t  version, days, flags, reserved;
+  uint16_t payload;
+
+  snapGet(p, magic);
+  snapGet(p, version);
+  snapGet(p, days);
+  snapGet(p, flags);
+  snapGet(p, reserved);
+  snapGet(p, payload);
+
+  if (magic != 0x53575041 || version != APW_SNAPSHOT_VERSION || days != MAX_DAYS) return false;
+  if (length < 14u + payload) return false;
+
+  const uint8_t *end = p + payload;
+  uint32_t crc;
+  snapGet(end, crc);
+  if (crc != crc32(buffer, 10 + payload)) return false;
+
+  // Skip the current values if they are not wanted, the location text is variable length
+  if ((flags & 1) && !current)
+  {
+    for (uint8_t i = 0; i < 3; i++) p += *p + 1;
+    p += APW_SNAP_CURRENT;
+  }
+
+  if ((flags & 1) && current)
+  {
+    snapGetText(p, current->name);
+    snapGetText(p, current->region);
+    snapGetText(p, current->country);
+    snapGet(p, current->localtime_epoch);
+    snapGet(p, current->last_updated_epoch);
+    snapGet(p, current->condition);
+    snapGet(p, current->is_day);
+    snapGet(p, current->code);
+    snapGet(p, current->metric);
+    snapGet(p, current->temp);
+    snapGet(p, current->wind);
+    snapGet(p, current->pressure);
+    snapGet(p, current->precip);
+    snapGet(p, current->alt_temp);
+    snapGet(p, current->alt_wind);
+    snapGet(p, current->alt_pressure);
+    snapGet(p, current->alt_precip);
+    snapGet(p, current->wind_degree);
+    snapGet(p, current->humidity);
+    snapGet(p, current->cloud);
+#ifndef TEXT_FROM_CODE
+    current->text = conditionText(current->condition, current->is_day);
+#endif
+    current->changed = 0xFFFF;
+  }
+
+  if ((flags & 2) && forecast)
+  {
+    snapGet(p, forecast->metric);
+    for (uint8_t i = 0; i < MAX_DAYS; i++)
+    {
+      uint16_t minutes;
+      snapGet(p, forecast->date_epoch[i]);
+      snapGet(p, forecast->maxtemp[i]);
+      snapGet(p, forecast->mintemp[i]);
+      snapGet(p, forecast->totalprecip[i]);
+      snapGet(p, forecast->alt_maxtemp[i]);
+      snapGet(p, forecast->alt_mintemp[i]);
+      snapGet(p, forecast->alt_totalprecip[i]);
+      snapGet(p, forecast->condition[i]);
+      snapGet(p, forecast->code[i]);
+      snapGet(p, minutes); forecast->sunrise[i]  = minutesToTime(minutes, "No sunrise");
+      snapGet(p, minutes); forecast->sunset[i]   = minutesToTime(minutes, "No sunset");
+      snapGet(p, minutes); forecast->moonrise[i] = minutesToTime(minutes, "No moonrise");
+      snapGet(p, minutes); forecast->moonset[i]  = minutesToTime(minutes, "No moonset");
+#ifndef TEXT_FROM_CODE
+      forecast->text[i] = conditionText(forecast->condition[i]);
+#endif
+      forecast->changed[i] = 0xFFFF;
+    }
+  }
+
+  // Saved in the units selected at the time, present in the units selected now
+  applyUnits(current, forecast);
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           snapPutText
+** Description:             Save a String as a length byte and the characters
+***************************************************************************************/
+void Apixu_Weather::snapPutText(uint8_t *&p, const String &text)
+{
+  uint8_t length = text.length() < LOCATION_LENGTH ? text.length() : LOCATION_LENGTH - 1;
+
+  *p++ = length;
+  memcpy(p, text.c_str(), length);
+  p += length;
+}
+
+/***************************************************************************************
+** Function name:           snapGetText
+** Description:             Restore a String saved by snapPutText()
+***************************************************************************************/
+void Apixu_Weather::snapGetText(const uint8_t *&p, String &text)
+{
+  char field[LOCATION_LENGTH];
+  uint8_t length = *p++;
+
+  if (length >= LOCATION_LENGTH) length = LOCATION_LENGTH - 1;
+  memcpy(field, p, length);
+  field[length] = 0;
+  p += length;
+  text = field;
+}
+
+/***************************************************************************************
+** Function name:           minutesToTime
+** Description:             Convert minutes since midnight to the server time format
+***************************************************************************************/
+String Apixu_Weather::minutesToTime(uint16_t minutes, const char *none)
+{
+  if (minutes == APW_NO_TIME) return none;
+
+  char text[9];
+  uint8_t hours = (minutes / 60) % 12;
+
+  // 12 AM is midnight and 12 PM is noon
+  sprintf(text, "%02u:%02u %s", hours ? hours : 12, minutes % 60, minutes < 720 ? "AM" : "PM");
+
+  return text;
+}
+
+/***************************************************************************************
+** Function name:           crc32
+** Description:             CRC-32 (IEEE 802.3) of a block of bytes
+***************************************************************************************/
+// Bitwise with no table, the snapshot is small so a table would cost more flash than time
+uint32_t Apixu_Weather::crc32(const uint8_t *data, size_t length)
+{
+  uint32_t crc = 0xFFFFFFFF;
+
+  while (length--)
+  {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+
+  return ~crc;
+}
+
+/***************************************************************************************
+** Function name:           applyUnits
+** Description:             Swap the parsed values to the units set by setMetric()
 ***************************************************************************************/
+// The server sends both unit sets and both are stored, so changing the units is only
+// a swap of the selected and alternate values
+void Apixu_Weather::applyUnits(APW_current *current, APW_forecast *forecast)
+{
+  if (current && current->metric != metric)
+  {
+    swapFloat(current->temp,     current->alt_temp);
+    swapFloat(current->wind,     current->alt_wind);
+    swapFloat(current->pressure, current->alt_pressure);
+    swapFloat(current->precip,   current->alt_precip);
+    current->metric = metric;
+    current->changed |= APW_CUR_UNITS;
+  }
+
+  if (forecast && forecast->metric != metric)
+  {
+    for (uint8_t i = 0; i < MAX_DAYS; i++)
+    {
+      swapFloat(forecast->maxtemp[i],     forecast->alt_maxtemp[i]);
+      swapFloat(forecast->mintemp[i],     forecast->alt_mintemp[i]);
+      swapFloat(forecast->totalprecip[i], forecast->alt_totalprecip[i]);
+      forecast->changed[i] |= APW_DAY_UNITS;
+    }
+    forecast->metric = metric;
+  }
+}
+
+void Apixu_Weather::swapFloat(float &a, float &b)
+{
+  float t = a; a = b; b = t;
+}
+
+
+/***************************************************************************************
+** Function name:           decimalToFloat, decimalToUInt
+** Description:             Convert the simple decimal numbers sent by the server
+***************************************************************************************/
+// The server sends numbers like "-12.3" or "1541865032" without exponents, so a
+// simple digit loop is used instead of toFloat() or atof() and no String is needed
+float Apixu_Weather::decimalToFloat(const char *str)
+{
+  bool negative = (*str == '-');
+  if (negative) str++;
+
+  uint32_t mantissa = 0;
+  uint32_t divisor  = 1;
+
+  while (*str >= '0' && *str <= '9') mantissa = mantissa * 10 + (*str++ - '0');
+
+  if (*str == '.')
+  {
+    str++;
+    // Limit fraction digits so the mantissa cannot overflow
+    while (*str >= '0' && *str <= '9' && divisor < 100000)
+    {
+      mantissa = mantissa * 10 + (*str++ - '0');
+      divisor *= 10;
+    }
+  }
+
+  float value = (float)mantissa / divisor;
+
+  return negative ? -value : value;
+}
+
+uint32_t Apixu_Weather::decimalToUInt(const char *str)
+{
+  uint32_t value = 0;
+
+  while (*str >= '0' && *str <= '9') value = value * 10 + (*str++ - '0');
+
+  return value;
+}
+
+// Returns the value x 10 rounded to the nearest tenth, e.g. "-1.95" returns -20
+int32_t Apixu_Weather::decimalToTenths(const char *str)
+{
+  bool negative = (*str == '-');
+  if (negative) str++;
+
+  int32_t value = 0;
+
+  while (*str >= '0' && *str <= '9') value = value * 10 + (*str++ - '0');
+  value *= 10;
+
+  if (*str == '.')
+  {
+    str++;
+    if (*str >= '0' && *str <= '9')
+    {
+      value += *str++ - '0';
+      if (*str >= '5' && *str <= '9') value++; // Round on the hundredths digit
+    }
+  }
+
+  return negative ? -value : value;
+}
+
+/***************************************************************************************
+** Function name:           timeToMinutes
+** Description:             Convert a "hh:mm AM" time to minutes since midnight
+***************************************************************************************/
+uint16_t Apixu_Weather::timeToMinutes(const char *str)
+{
+  if (str[0] < '0' || str[0] > '9') return APW_NO_TIME; // e.g. "No moonrise"
+
+  uint16_t hours = decimalToUInt(str);
+  while (*str >= '0' && *str <= '9') str++;
+  if (*str++ != ':') return APW_NO_TIME;
+
+  uint16_t minutes = decimalToUInt(str);
+  while (*str >= '0' && *str <= '9') str++;
+  while (*str == ' ') str++;
+
+  // 12 AM is midnight and 12 PM is noon
+  if (hours == 12) hours = 0;
+  if (*str == 'P' || *str == 'p') hours += 12;
+
+  return hours * 60 + minutes;
+}
+
+/***************************************************************************************
+** Function name:           copyText
+** Description:             Copy a text value into a fixed size field, no heap used
+***************************************************************************************/
+void Apixu_Weather::copyText(char *field, const char *val, size_t size)
+{
+  strncpy(field, val, size - 1);
+  field[size - 1] = 0;
+}
+
+/***************************************************************************************
+** Function name:           storeText
+** Description:             Store a text value, the only heap use in the callbacks
+***************************************************************************************/
+// An unchanged value is not stored again, so a repeat request makes no heap churn
+void Apixu_Weather::storeText(String &field, const char *val, uint16_t &changed, uint16_t bit)
+{
+  stored |= bit;
+  if (field.equals(val)) return;
+  field = val;
+  changed |= bit;
+  stats.stores++;
+}
+
+/***************************************************************************************
+** Function name:           storeUnit
+** Description:             Store a value in the selected or the alternate units field
+***************************************************************************************/
+// isMetric is true for a metric key e.g. "temp_c", false for e.g. "temp_f"
+void Apixu_Weather::storeUnit(bool isMetric, float &field, float &alt, const char *val,
+                              uint16_t &changed, uint16_t bit)
+{
+  if (isMetric == metric) storeNumber(field, decimalToFloat(val), changed, bit);
+  else alt = decimalToFloat(val);
+}
 
+/***************************************************************************************
+** Function name:           value
+** Description:             Value callback, timed for the statistics
+***************************************************************************************/
+// The sketch callbacks are made after the timing so they are not counted as parse time
 void Apixu_Weather::value(const char *val) {
 
-  String value = val;
+  uint32_t dt = micros();
 
-  if (data_set == "location") {
-    // Using the APW_current struct rather than create one for location
-    if (currentKey == "name") current->name = value;
-    else
-    if (currentKey == "region") current->region = value;
-    else
-    if (currentKey == "country") current->country = value;
-    else
-    if (currentKey == "localtime_epoch") current->localtime_epoch = (uint32_t)value.toInt();
-    return;
+  stats.values++;
+  stored = 0;
+  uint16_t day = arrayIndex;
+  storeValue(val);
+
+  stats.callback_us += micros() - dt;
+
+  // Each callback needs only its own struct, a sketch may pass just one of them
+  if (stored && currentCallback && current && (data_set == LOCATION_SET || data_set == CURRENT_SET))
+    currentCallback(currentContext, stored, current);
+
+  // The day index is incremented by the last value of the day
+  if (dayCallback && forecast && data_set == FORECAST_SET && arrayIndex != day)
+    dayCallback(dayContext, day, forecast);
+}
+
+/***************************************************************************************
+** Function name:           storeValue (full data set)
+** Description:             Stores the parsed data in the structures for sketch access
+***************************************************************************************/
+void Apixu_Weather::storeValue(const char *val) {
+
+  // Kept for the start of the hourly window
+  if (data_set == LOCATION_SET && keyHash == APW_hash("localtime_epoch"))
+    localEpoch = decimalToUInt(val);
+
+  if (data_set == HOUR_SET) { valueHourly(val); return; }
+
+  if (!current && !forecast) { valueCompact(val); return; }
+
+  // The value text is used in place, numbers are converted directly and only text
+  // values stored in the structs use the heap
+
+  // Dispatch on the data set, then on the key name hash. Unit dependant keys are
+  // stored in the selected units field or the alternate units field
+  switch (data_set) {
+
+    case LOCATION_SET:
+      // Using the APW_current struct rather than create one for location
+      if (!current) return; // Only the forecast wanted
+      switch (keyHash) {
+        case APW_hash("name"):            storeText(current->name, val, current->changed, APW_CUR_NAME); break;
+        case APW_hash("region"):          storeText(current->region, val, current->changed, APW_CUR_REGION); break;
+        case APW_hash("country"):         storeText(current->country, val, current->changed, APW_CUR_COUNTRY); break;
+        case APW_hash("localtime_epoch"): storeNumber(current->localtime_epoch, decimalToUInt(val), current->changed, APW_CUR_LOCALTIME); break;
+      }
+      return;
+
+    case CURRENT_SET:
+      if (!current) return;
+      switch (keyHash) {
+        case APW_hash("last_updated_epoch"): storeNumber(current->last_updated_epoch, decimalToUInt(val), current->changed, APW_CUR_UPDATED); break;
+        case APW_hash("temp_c"):      storeUnit(true,  current->temp, current->alt_temp, val, current->changed, APW_CUR_TEMP); break;
+        case APW_hash("temp_f"):      storeUnit(false, current->temp, current->alt_temp, val, current->changed, APW_CUR_TEMP); break;
+#ifndef TEXT_FROM_CODE
+        case APW_hash("text"):        storeText(current->text, val, current->changed, APW_CUR_TEXT); break;
+#endif
+        case APW_hash("is_day"):      storeNumber(current->is_day, (uint8_t)decimalToUInt(val), current->changed, APW_CUR_IS_DAY); break;
+        case APW_hash("code"):
+          storeNumber(current->condition, (uint16_t)decimalToUInt(val), current->changed, APW_CUR_CONDITION);
+          storeNumber(current->code, iconIndex(current->condition), current->changed, APW_CUR_CODE);
+          break;
+        case APW_hash("wind_mph"):    storeUnit(false, current->wind, current->alt_wind, val, current->changed, APW_CUR_WIND); break;
+        case APW_hash("wind_kph"):    storeUnit(true,  current->wind, current->alt_wind, val, current->changed, APW_CUR_WIND); break;
+        case APW_hash("wind_degree"): storeNumber(current->wind_degree, (uint16_t)decimalToUInt(val), current->changed, APW_CUR_WIND_DEGREE); break;
+        case APW_hash("pressure_mb"): storeUnit(true,  current->pressure, current->alt_pressure, val, current->changed, APW_CUR_PRESSURE); break;
+        case APW_hash("pressure_in"): storeUnit(false, current->pressure, current->alt_pressure, val, current->changed, APW_CUR_PRESSURE); break;
+        case APW_hash("precip_mm"):   storeUnit(true,  current->precip, current->alt_precip, val, current->changed, APW_CUR_PRECIP); break;
+        case APW_hash("precip_in"):   storeUnit(false, current->precip, current->alt_precip, val, current->changed, APW_CUR_PRECIP); break;
+        case APW_hash("humidity"):    storeNumber(current->humidity, (uint8_t)decimalToUInt(val), current->changed, APW_CUR_HUMIDITY); break;
+        case APW_hash("cloud"):       storeNumber(current->cloud, (uint8_t)decimalToUInt(val), current->changed, APW_CUR_CLOUD); break;
+      }
+      return;
+
+    case FORECAST_SET:
+      if (!forecast) return; // Only the current conditions and the hourly store wanted
+      if (arrayIndex >= MAX_DAYS) return; // Message has more days than storage allocated
+
+      switch (keyHash) {
+        case APW_hash("date_epoch"):     storeNumber(forecast->date_epoch[arrayIndex], decimalToUInt(val), forecast->changed[arrayIndex], APW_DAY_DATE); break;
+        case APW_hash("maxtemp_c"):      storeUnit(true,  forecast->maxtemp[arrayIndex], forecast->alt_maxtemp[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MAXTEMP); break;
+        case APW_hash("maxtemp_f"):      storeUnit(false, forecast->maxtemp[arrayIndex], forecast->alt_maxtemp[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MAXTEMP); break;
+        case APW_hash("mintemp_c"):      storeUnit(true,  forecast->mintemp[arrayIndex], forecast->alt_mintemp[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MINTEMP); break;
+        case APW_hash("mintemp_f"):      storeUnit(false, forecast->mintemp[arrayIndex], forecast->alt_mintemp[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MINTEMP); break;
+        case APW_hash("totalprecip_mm"): storeUnit(true,  forecast->totalprecip[arrayIndex], forecast->alt_totalprecip[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_PRECIP); break;
+        case APW_hash("totalprecip_in"): storeUnit(false, forecast->totalprecip[arrayIndex], forecast->alt_totalprecip[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_PRECIP); break;
+#ifndef TEXT_FROM_CODE
+        case APW_hash("text"):           storeText(forecast->text[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_TEXT); break;
+#endif
+        case APW_hash("code"):
+          storeNumber(forecast->condition[arrayIndex], (uint16_t)decimalToUInt(val), forecast->changed[arrayIndex], APW_DAY_CONDITION);
+          storeNumber(forecast->code[arrayIndex], iconIndex(forecast->condition[arrayIndex]), forecast->changed[arrayIndex], APW_DAY_CODE);
+          break;
+        // These are in the forecast/astro object but have unique names, so no need to use the object name
+        case APW_hash("sunrise"):        storeText(forecast->sunrise[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_SUNRISE); break;
+        case APW_hash("sunset"):         storeText(forecast->sunset[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_SUNSET); break;
+        case APW_hash("moonrise"):       storeText(forecast->moonrise[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MOONRISE); break;
+        case APW_hash("moonset"):
+          storeText(forecast->moonset[arrayIndex], val, forecast->changed[arrayIndex], APW_DAY_MOONSET);
+          arrayIndex++; // Using last item in JSON list to increment array index
+          if (arrayIndex >= MAX_DAYS) { daysDone = true; checkCaptured(); }
+          break;
+      }
+      return;
   }
+}
 
-  if (data_set == "current") {
-    if (currentKey == "last_updated_epoch") current->last_updated_epoch = (uint32_t)value.toInt();
-    else
-    if (currentKey == "temp_c"  && metric) current->temp = value.toFloat();
-    else
-    if (currentKey == "temp_f"  && !metric) current->temp = value.toFloat();
-    else
-    if (currentKey == "text") current->text = value;
-    else
-    if (currentKey == "code") current->code =  iconIndex( (uint16_t)value.toInt() );
-    else
-    if (currentKey == "wind_mph" && !metric) current->wind = value.toFloat();
-    else
-    if (currentKey == "wind_kph" && metric) current->wind = value.toFloat();
-    else
-    if (currentKey == "wind_degree") current->wind_degree = (uint16_t)value.toInt();
-    else
-    if (currentKey == "pressure_mb" && metric) current->pressure = value.toFloat();
-    else
-    if (currentKey == "pressure_in" && !metric) current->pressure = value.toFloat();
-    else
-    if (currentKey == "precip_mm" && metric) current->precip = value.toFloat();
-    else
-    if (currentKey == "precip_in" && !metric) current->precip = value.toFloat();
-    else
-    if (currentKey == "humidity") current->humidity = (uint8_t)value.toInt();
-    else
-    if (currentKey == "cloud") current->cloud = (uint8_t)value.toInt();
+/***************************************************************************************
+** Function name:           valueCompact
+** Description:             Stores the parsed data in the compact structures
+***************************************************************************************/
+// Metric values only, converted to fixed point tenths. Nothing is stored on the heap.
+void Apixu_Weather::valueCompact(const char *val) {
+
+  switch (data_set) {
+
+    case LOCATION_SET:
+      if (!currentCompact) return;
+      switch (keyHash) {
+        case APW_hash("name"):            copyText(currentCompact->name, val, LOCATION_LENGTH); break;
+        case APW_hash("region"):          copyText(currentCompact->region, val, LOCATION_LENGTH); break;
+        case APW_hash("country"):         copyText(currentCompact->country, val, LOCATION_LENGTH); break;
+        case APW_hash("localtime_epoch"): currentCompact->localtime_epoch = decimalToUInt(val); break;
+      }
+      return;
+
+    case CURRENT_SET:
+      if (!currentCompact) return;
+      switch (keyHash) {
+        case APW_hash("last_updated_epoch"): currentCompact->last_updated_epoch = decimalToUInt(val); break;
+        case APW_hash("temp_c"):      currentCompact->temp = (int16_t)decimalToTenths(val); break;
+        case APW_hash("code"):
+          currentCompact->condition = (uint16_t)decimalToUInt(val);
+          currentCompact->code = iconIndex(currentCompact->condition);
+          break;
+        case APW_hash("wind_kph"):    currentCompact->wind = (uint16_t)decimalToTenths(val); break;
+        case APW_hash("wind_degree"): currentCompact->wind_degree = (uint16_t)decimalToUInt(val); break;
+        case APW_hash("pressure_mb"): currentCompact->pressure = (uint16_t)decimalToTenths(val); break;
+        case APW_hash("precip_mm"):   currentCompact->precip = (uint16_t)decimalToTenths(val); break;
+        case APW_hash("humidity"):    currentCompact->humidity = (uint8_t)decimalToUInt(val); break;
+        case APW_hash("cloud"):       currentCompact->cloud = (uint8_t)decimalToUInt(val); break;
+      }
+      return;
+
+    case FORECAST_SET:
+    {
+      if (!dayCompact || arrayIndex >= compactDays) return;
+
+      APW_day_compact &day = dayCompact[arrayIndex];
+
+      switch (keyHash) {
+        case APW_hash("date_epoch"):     day.date_epoch = decimalToUInt(val); break;
+        case APW_hash("maxtemp_c"):      day.maxtemp = (int16_t)decimalToTenths(val); break;
+        case APW_hash("mintemp_c"):      day.mintemp = (int16_t)decimalToTenths(val); break;
+        case APW_hash("totalprecip_mm"): day.totalprecip = (uint16_t)decimalToTenths(val); break;
+        case APW_hash("code"):
+          day.condition = (uint16_t)decimalToUInt(val);
+          day.code = iconIndex(day.condition);
+          break;
+        case APW_hash("sunrise"):        day.sunrise = timeToMinutes(val); break;
+        case APW_hash("sunset"):         day.sunset = timeToMinutes(val); break;
+        case APW_hash("moonrise"):       day.moonrise = timeToMinutes(val); break;
+        case APW_hash("moonset"):
+          day.moonset = timeToMinutes(val);
+          arrayIndex++; // Using last item in JSON list to increment array index
+          if (arrayIndex >= compactDays) { daysDone = true; checkCaptured(); }
+          break;
+      }
+      return;
+    }
+  }
+}
+
+/***************************************************************************************
+** Function name:           valueHourly
+** Description:             Stores the parsed hourly data, quantized to fit the record
+***************************************************************************************/
+void Apixu_Weather::valueHourly(const char *val) {
+
+  // time_epoch is first in each hour object and starts a new record
+  if (keyHash == APW_hash("time_epoch"))
+  {
+    uint32_t epoch = decimalToUInt(val);
 
+    // Hours that ended before the server local time are not stored
+    hourRecord = (epoch + 3600 > localEpoch) ? hourly->add() : nullptr;
+    if (!hourRecord) return;
+
+    hourRecord->time_epoch = epoch;
+    hourLevel = objectLevel;
     return;
   }
 
-  if (data_set == "forecast") {
-    if (currentKey == "date_epoch") forecast->date_epoch[arrayIndex] = (uint32_t)value.toInt();
-    else
-    if (currentKey == "maxtemp_c"  && metric) forecast->maxtemp[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "maxtemp_f"  && !metric) forecast->maxtemp[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "mintemp_c"  && metric) forecast->mintemp[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "mintemp_f"  && !metric) forecast->mintemp[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "totalprecip_mm"  && metric) forecast->totalprecip[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "totalprecip_in"  && !metric) forecast->totalprecip[arrayIndex] = value.toFloat();
-    else
-    if (currentKey == "text") forecast->text[arrayIndex] = value;
-    else
-    if (currentKey == "code") forecast->code[arrayIndex] = iconIndex( (uint16_t)value.toInt() );
-    else
-    // These are in the forecast/astro object but have unique names, so no need to use the object name
-    if (currentKey == "sunrise") forecast->sunrise[arrayIndex] = value;
-    else
-    if (currentKey == "sunset") forecast->sunset[arrayIndex] = value;
-    else
-    if (currentKey == "moonrise") forecast->moonrise[arrayIndex] = value;
-    else
-    if (currentKey == "moonset")
+  if (!hourRecord) return;
+
+  switch (keyHash) {
+    case APW_hash("temp_c"):         hourRecord->temp = (int16_t)decimalToTenths(val); break;
+    case APW_hash("precip_mm"):      hourRecord->precip = (uint16_t)decimalToTenths(val); break;
+    case APW_hash("wind_kph"):
     {
-      forecast->moonset[arrayIndex] = value;
-      arrayIndex++; // Using last item in JSON list to increment array index
+      uint32_t kph = (decimalToTenths(val) + 5) / 10;
+      hourRecord->wind = (kph > 255) ? 255 : kph;
+      break;
     }
-    return;
+    case APW_hash("wind_degree"):    hourRecord->wind_dir = (uint8_t)(decimalToUInt(val) / 2); break;
+    case APW_hash("code"):           hourRecord->code = iconIndex( (uint16_t)decimalToUInt(val) ); break;
+    case APW_hash("chance_of_rain"): hourRecord->chance_of_rain = (uint8_t)decimalToUInt(val); break;
   }
 }
+
+/***************************************************************************************
+** Function name:           checkCaptured
+** Description:             Set captured if every field requested has been stored
+***************************************************************************************/
+void Apixu_Weather::checkCaptured(void)
+{
+  captured = daysDone && (!hourly || hourly->full());
+}
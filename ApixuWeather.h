@@ -17,6 +17,38 @@
 
 #include "User_Setup.h"
 
+#ifndef READ_BUFFER_SIZE
+  #define READ_BUFFER_SIZE 256
+#endif
+
+#ifndef RESPONSE_TIMEOUT
+  #define RESPONSE_TIMEOUT 4000 // ms default for the first response byte
+#endif
+
+#ifndef COMPLETE_TIMEOUT
+  #define COMPLETE_TIMEOUT 8000 // ms default for the complete response
+#endif
+
+#ifndef TEXT_LENGTH
+  #define TEXT_LENGTH 128 // Longest key or value text from parseBuffer(), longer is cut
+#endif
+
+#ifndef INFLATE_WINDOW
+  #ifdef ESP8266
+    #define INFLATE_WINDOW 8192 // Leaves heap for the WiFi stack
+  #else
+    #define INFLATE_WINDOW 32768
+  #endif
+#endif
+
+// Snapshot format version, changed when the layout changes so old snapshots are rejected
+#define APW_SNAPSHOT_VERSION 1
+
+// Largest snapshot from saveSnapshot(), 409 bytes with the defaults so it fits in the
+// 512 bytes of ESP8266 RTC user memory. The location names are kept to
+// LOCATION_LENGTH - 1 characters, as in the compact structs.
+#define APW_SNAPSHOT_SIZE (14 + 50 + 3 * LOCATION_LENGTH + 39 * MAX_DAYS)
+
 #if (MAX_DAYS < 1)
   #undef MAXDAYS
   #define MAX_DAYS 1
@@ -29,6 +61,78 @@
 
 #include "Data_Point_Set.h"
 
+#include "APW_Inflate.h"
+
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else
+  #include <WiFi.h>
+#endif
+
+#include <JSON_Decoder.h>
+
+/***************************************************************************************
+** Description:   Request states and errors, returned by poll() and getError()
+***************************************************************************************/
+enum APW_state : uint8_t {
+  APW_IDLE,     // No request started
+  APW_CONNECT,  // Connect to the server on next poll()
+  APW_SEND,     // Send the GET request on next poll()
+  APW_WAIT,     // Waiting for the response to arrive
+  APW_PARSE,    // Reading and parsing the response, one block per poll()
+  APW_DONE,     // Response parsed without error
+  APW_FAILED    // Request failed, see getError()
+};
+
+enum APW_error : uint8_t {
+  APW_NO_ERROR,
+  APW_CONNECT_FAILED,   // Client could not connect to the server
+  APW_RESPONSE_TIMEOUT, // No response within 4s (default) of the request being sent
+  APW_PARSE_TIMEOUT,    // Response not complete within 8s (default) of the request being sent
+  APW_PARSE_ERROR,      // JSON parser reported an error or no JSON document found
+  APW_HTTP_ERROR,       // Server status code not 2xx, see getStats().status
+  APW_DECODE_ERROR,     // Compressed response could not be decoded
+  APW_INCOMPLETE_ERROR  // Connection closed before the Content-Length or last chunk
+};
+
+/***************************************************************************************
+** Description:   Request statistics, refreshed at the start of every request or parse
+***************************************************************************************/
+// Times are in microseconds. For parseMessage() and replayForecast() only the parse
+// fields are used.
+typedef struct APW_stats {
+  uint32_t total_us      = 0; // Request start to finish, or whole parse
+  uint32_t connect_us    = 0; // DNS lookup and connect, 0 if a kept connection was used
+  uint32_t first_byte_us = 0; // Request sent to first response byte available
+  uint32_t parse_us      = 0; // Time in the parser, includes the callbacks
+  uint32_t callback_us   = 0; // Time in the key() and value() callbacks
+  uint32_t bytes         = 0; // Characters received (includes HTTP header)
+  uint32_t header_bytes  = 0; // HTTP header characters, not fed to the parser
+  uint32_t body_bytes    = 0; // Response body characters, as received
+  uint32_t decoded_bytes = 0; // Body characters after decompression, 0 if not compressed
+  uint32_t keys          = 0; // Number of key() callbacks
+  uint32_t values        = 0; // Number of value() callbacks
+  uint32_t stores        = 0; // String stores into the output structs, the only heap
+                              // allocations made by the callbacks
+  uint32_t skipped       = 0; // Characters in skipped subtrees, not fed to the parser
+  uint32_t heap_start    = 0; // Free heap when the request started
+  uint32_t heap_min      = 0; // Lowest free heap seen at the end of each JSON object
+  uint32_t heap_end      = 0; // Free heap when the request finished
+  bool     reused        = false;        // Sent on a kept alive connection
+  bool     chunked       = false;        // Response used chunked transfer encoding
+  uint16_t status        = 0;            // HTTP status code, 0 if no HTTP header
+  APW_error error        = APW_NO_ERROR; // Result, shows which timeout fired
+} APW_stats;
+
+/***************************************************************************************
+** Description:   Key name hash, FNV-1a 32 bit
+***************************************************************************************/
+// constexpr so key names can be hashed at compile time and used as switch case labels.
+// The names sent by the Apixu server have been checked to be collision free.
+constexpr uint32_t APW_hash(const char *key, uint32_t hash = 2166136261UL)
+{
+  return *key ? APW_hash(key + 1, (hash ^ (uint8_t)*key) * 16777619UL) : hash;
+}
 
 /***************************************************************************************
 ** Description:   JSON interface class
@@ -36,18 +140,157 @@
 class Apixu_Weather: public JsonListener {
 
   public:
+    Apixu_Weather() = default;
+    ~Apixu_Weather() { delete inflater; delete[] inflateWindow; }
+
+    // Not copyable, the decoder and its window are owned by the instance
+    Apixu_Weather(const Apixu_Weather &) = delete;
+    Apixu_Weather &operator=(const Apixu_Weather &) = delete;
+
     // Sketch calls this forecast request, it returns true if no parse errors encountered
     bool getForecast(APW_current *current, APW_forecast  *forecast,
                      String api_key, String city);
 
+    // Compact fixed size versions, Days is set by the APW_forecast_compact type so
+    // MAX_DAYS is not used. Values are stored in metric units, see Data_Point_Set.h
+    template <uint8_t Days>
+    bool getForecast(APW_current_compact *current, APW_forecast_compact<Days> *forecast,
+                     String api_key, String city)
+    {
+      if (!beginForecast(current, forecast, api_key, city)) return false;
+      while (poll() < APW_DONE) yield();
+      return (state == APW_DONE);
+    }
+
+    template <uint8_t Days>
+    bool beginForecast(APW_current_compact *current, APW_forecast_compact<Days> *forecast,
+                       String api_key, String city)
+    {
+      return beginCompact(current, forecast ? forecast->day : nullptr, Days, api_key, city);
+    }
+
+    template <uint8_t Days>
+    bool replayForecast(APW_current_compact *current, APW_forecast_compact<Days> *forecast,
+                        PGM_P json)
+    {
+      return replayCompact(current, forecast ? forecast->day : nullptr, Days, json);
+    }
+
     // Called by library (or user sketch), sends a GET request to a http url
     bool parseRequest(String url); // and parses response, returns true if no parse errors
 
+    // Non-blocking versions of getForecast() and parseRequest(), return false if a
+    // request is already in progress. The request is then advanced by calling poll()
+    bool beginForecast(APW_current *current, APW_forecast  *forecast,
+                       String api_key, String city);
+    bool beginRequest(String url);
+
+    // Advance a request started by beginForecast() or beginRequest() by one bounded
+    // step, returns APW_DONE or APW_FAILED when complete
+    APW_state poll(void);
+
+    // True while a request is in progress
+    bool busy(void) { return (state > APW_IDLE) && (state < APW_DONE); }
+
+    // Request progress, state, error and response bytes received so far
+    APW_state getState(void) { return state; }
+    APW_error getError(void) { return requestError; }
+    uint32_t  bytesReceived(void) { return stats.bytes; }
+
+    // Set the transport used by parseRequest, any Arduino Client e.g. WiFiClientSecure or
+    // APW_ReplayClient. Pass nullptr to use a WiFiClient (default). A connection kept
+    // alive on the old client is closed, so that client may then be destroyed.
+    void setClient(Client *client);
+
+    // Set the server host name and port, default api.apixu.com port 80. The host text
+    // is not copied, it must stay valid while requests are made, e.g. a literal.
+    void setServer(const char *host, uint16_t port = 80);
+
+    // Collect the hourly forecast from the hour in progress at the server local time
+    // until the store is full, e.g. an APW_hourly<24> for the next 24 hours. The store
+    // is refilled by each forecast request. Pass nullptr to stop (default).
+    void setHourly(APW_hourly_ring *hourly) { this->hourly = hourly; }
+
+    // Ask the server for a gzip or deflate compressed response (default false). The
+    // response is decoded as it arrives using an INFLATE_WINDOW byte buffer allocated
+    // here. A response that cannot be decoded, e.g. it refers back further than the
+    // window, fails with APW_DECODE_ERROR and compression is then turned off. Returns
+    // false if the buffer cannot be allocated or INFLATE_WINDOW is less than the 32768
+    // bytes the server may refer back (e.g. the ESP8266 default), compression then
+    // stays off.
+    bool setCompression(bool enable);
+
+    // Keep the connection open between requests (default false)
+    void setKeepAlive(bool keep);
+
+    // Set the time allowed after the request is sent for the first response byte
+    // (default 4000ms) and for the complete response (default 8000ms)
+    void setTimeouts(uint32_t response_ms, uint32_t complete_ms);
+
+    // Replay a recorded forecast.json message held in RAM or PROGMEM, no network used.
+    // The replay and parse calls return false while a beginForecast() request is busy.
+    bool replayForecast(APW_current *current, APW_forecast *forecast, PGM_P json);
+
+    // Called by library (or user sketch), feeds a null terminated JSON message held
+    // in RAM or PROGMEM to the parser, returns true if no parse errors
+    bool parseMessage(PGM_P json);
+
+    // Parse a complete forecast.json message of length bytes held in RAM, e.g. read
+    // from a file. The values are the same as from replayForecast() but the message
+    // is scanned in place rather than fed to the parser a character at a time.
+    bool parseForecast(APW_current *current, APW_forecast *forecast,
+                       const char *json, size_t length);
+
+    // Called by library (or user sketch), scans a complete JSON message in RAM and
+    // makes the same callbacks as the parser, returns true if no parse errors
+    bool parseBuffer(const char *json, size_t length);
+
+    // Statistics for the last request or parse e.g. times, bytes, callbacks, free heap
+    const APW_stats& getStats(void) { return stats; }
+
+    // Print the statistics to the serial port, called at the end of every request
+    // if SHOW_REQUEST is defined in User_Setup.h
+    void printStats(void);
+
     // Convert the icon index to an icon filename e.g. "partly-cloudy"
     const char* iconName(uint8_t index);
 
+    // Condition text for an Apixu condition code e.g. "Partly cloudy" for 1003, from
+    // a table in program memory. Use is_day = false for the night text of the current
+    // weather. Returns "" for an unknown code.
+    const __FlashStringHelper* conditionText(uint16_t condition, bool is_day = true);
+
+    // Progressive callbacks, so a display can show each value as it arrives instead of
+    // after the whole response. CurrentCallback is called as each location or current
+    // value is stored with the APW_CUR_ bits of the values, e.g. APW_CUR_TEMP, and with
+    // APW_CUR_COMPLETE when the current object ends. DayCallback is called when all the
+    // values of a forecast day are stored. The values are in the structs passed to
+    // getForecast() or beginForecast(). Not called for the compact structs. Pass
+    // nullptr to stop (default).
+    typedef void (*CurrentCallback)(void *context, uint16_t field, APW_current *current);
+    typedef void (*DayCallback)(void *context, uint8_t index, APW_forecast *forecast);
+
+    void onCurrent(CurrentCallback callback, void *context = nullptr);
+    void onForecastDay(DayCallback callback, void *context = nullptr);
+
     // Set values to be metric (true) or imperial (false)
     void setMetric(bool true_or_false);
+    bool getMetric(void) { return metric; }
+
+    // Save the values to a binary snapshot, e.g. in RTC memory or a flash file, so they
+    // can be restored after a deep sleep with no request. Either pointer may be nullptr.
+    // Returns the snapshot length, or 0 if size is less than APW_SNAPSHOT_SIZE.
+    size_t saveSnapshot(uint8_t *buffer, size_t size, APW_current *current, APW_forecast *forecast);
+
+    // Restore the values from a snapshot in the units set by setMetric() and set all the
+    // changed bits. Returns false, with the structs unchanged, if the snapshot is not
+    // valid e.g. checksum error or saved by a different library version.
+    bool loadSnapshot(const uint8_t *buffer, size_t length, APW_current *current, APW_forecast *forecast);
+
+    // Present parsed values in the units set by setMetric(), both unit sets are
+    // captured by the parse so the values are swapped and no new request is needed.
+    // The changed bits of the swapped values are set.
+    void applyUnits(APW_current *current, APW_forecast *forecast);
 
   private:
 
@@ -69,13 +312,109 @@ class Apixu_Weather: public JsonListener {
 
     void key(const char *key);         // The current "object" or "name" for a name:value pair
     void value(const char *value);     // String value from name:value pair e.g. "1.23" or "rain"
+    void storeValue(const char *val);  // Stores the value, value() adds the timing
 
     void whitespace(char c);           // Whitespace character in JSON - not used
 
     void error( const char *message ); // Error message is sent to serial port
 
+    // Non-template parts of the compact structure functions
+    bool beginCompact(APW_current_compact *current, APW_day_compact *day, uint8_t days,
+                      String api_key, String city);
+    bool replayCompact(APW_current_compact *current, APW_day_compact *day, uint8_t days,
+                       PGM_P json);
+
+    // Forecast request path for the number of days, the server is set by setServer()
+    String forecastUrl(const String &api_key, const String &city, uint8_t days);
+
+    // Stores the parsed data in the compact structures
+    void valueCompact(const char *val);
+
+    // Stores the parsed hourly data in the hourly store
+    void valueHourly(const char *val);
+
+    // Set captured if every field requested has been stored
+    void checkCaptured(void);
+
     // Convert the weather condition number to an icon image index
     uint8_t iconIndex(uint16_t index); 
+    uint8_t conditionRow(uint16_t code); // Row in the APW_Conditions.h tables
+
+    // Close the request and set the final state
+    APW_state finish(APW_error result);
+
+    // Connect the transport, the host address is cached for the default WiFiClient
+    bool connectClient(void);
+
+    // Read the HTTP response header, returns the number of bytes used
+    uint16_t parseHeader(const uint8_t *buffer, uint16_t count);
+
+    // Remove the chunk size lines from a chunked body and feed the data to the parser
+    void parseChunked(const uint8_t *buffer, uint16_t count);
+
+    // Feed body data to the parser, decoding it first if it is compressed
+    void parseBody(const uint8_t *buffer, uint16_t count);
+
+    // APW_Inflate output function, feeds the decoded bytes to the parser
+    static void inflateOutput(void *context, const uint8_t *data, uint16_t count);
+    const char* skipSpace(const char *str);
+
+    // Feed a block of received characters to the parser
+    void parseBlock(JSON_Decoder &parser, const uint8_t *buffer, int count);
+
+    // Pass over a skipped subtree, returns a pointer to the closing bracket or end
+    const uint8_t* skipBlock(const uint8_t *buffer, const uint8_t *end);
+
+    // Copy a string from a message in RAM to text without the escapes, buffer is after
+    // the opening quote. Returns the position after the closing quote, or nullptr if the
+    // message ends first.
+    const uint8_t* copyString(const uint8_t *buffer, const uint8_t *end, char *text);
+
+    // Fast conversion of the simple decimal numbers sent by the server, no heap used
+    float    decimalToFloat(const char *str);
+    uint32_t decimalToUInt(const char *str);
+    int32_t  decimalToTenths(const char *str);
+
+    // Convert "06:35 AM" to minutes since midnight, APW_NO_TIME if not a time
+    uint16_t timeToMinutes(const char *str);
+
+    // Copy text into a fixed size field, truncated to fit
+    void     copyText(char *field, const char *val, size_t size);
+
+    // Store a text value in a String if it differs, counted in the statistics. The
+    // bit is set in the changed mask when the stored value changes.
+    void     storeText(String &field, const char *val, uint16_t &changed, uint16_t bit);
+
+    // Store a number, setting the bit in the changed mask if the value differs
+    template <typename T>
+    void     storeNumber(T &field, T val, uint16_t &changed, uint16_t bit) {
+      stored |= bit;
+      if (field != val) { field = val; changed |= bit; }
+    }
+
+    // Store a unit dependant value in the selected or the alternate field, only the
+    // selected field sets the bit in the changed mask
+    void     storeUnit(bool isMetric, float &field, float &alt, const char *val,
+                       uint16_t &changed, uint16_t bit);
+    void     swapFloat(float &a, float &b);
+
+    // Snapshot values are copied in the native byte order, snapshots are not portable
+    template <typename T>
+    static void snapPut(uint8_t *&p, const T &val) { memcpy(p, &val, sizeof(T)); p += sizeof(T); }
+    template <typename T>
+    static void snapGet(const uint8_t *&p, T &val) { memcpy(&val, p, sizeof(T)); p += sizeof(T); }
+    static void snapPutText(uint8_t *&p, const String &text);
+    static void snapGetText(const uint8_t *&p, String &text);
+
+    // Convert minutes since midnight to "06:35 AM", or the none text for APW_NO_TIME
+    static String minutesToTime(uint16_t minutes, const char *none);
+
+    // CRC-32 as used by gzip, protects the snapshot
+    static uint32_t crc32(const uint8_t *data, size_t length);
+
+    // Reset the statistics at the start of a parse and complete them at the end
+    void statsStart(void);
+    void statsEnd(void);
 
   private: // Variables used internal to library
 
@@ -87,19 +426,98 @@ class Apixu_Weather: public JsonListener {
     APW_current  *current;  // pointer provided by sketch to the APW_current struct
     APW_forecast *forecast; // pointer provided by sketch to the APW_daily struct
 
+    // Compact alternatives, only one of the two structure sets is used per request
+    APW_current_compact *currentCompact = nullptr;
+    APW_day_compact     *dayCompact     = nullptr;
+    uint8_t              compactDays    = 0;   // Days in the dayCompact array
+
 
     bool     parseOK;       // true if the parse been completed
                             // (does not mean data values gathered are good!)
 
-    bool     metric;        // Metric units if true
+    bool     captured = false; // true when every field requested has been stored, the
+                               // rest of the response is then not read
+    bool     daysDone = false; // All forecast days requested have been stored
 
-    String   currentObject; // Current object e.g. "daily"
-    String   data_set;      // A copy of the last object name at the head of an array
+    // Hourly store set by the sketch, the record being filled and the object level of
+    // its hour object, and the server local time the hourly window starts from
+    APW_hourly_ring *hourly     = nullptr;
+    APW_hour        *hourRecord = nullptr;
+    uint16_t         hourLevel  = 0;
+    uint32_t         localEpoch = 0;
+
+    // Subtree skipping, the characters of an unwanted array or object are scanned for
+    // the closing bracket instead of being parsed, so there are no callbacks
+    uint16_t skipDepth  = 0;     // Bracket depth in the skipped subtree, 0 = not skipping
+    bool     skipString = false; // In a string so brackets are ignored
+    bool     skipEscape = false; // Last string character was a backslash
+
+    bool     metric = true; // Metric units if true
+
+    enum : uint8_t { NO_SET, LOCATION_SET, CURRENT_SET, FORECAST_SET, HOUR_SET };
+    uint8_t  data_set;      // Set from the last object name at the head of an array
                             // short equivalent to path.
+    uint32_t keyHash;       // APW_hash() of the name key of the name:value pair,
+                            // e.g. "temp_c", used to dispatch values. The key text
+                            // is not copied so no heap is used per callback
     uint16_t objectLevel;   // Object level, increments for new object, decrements at end
-    String   currentKey;    // Name key of the name:value pair e.g "temperature"
     uint16_t arrayIndex;    // Array index e.g. 5 for day 5 forecast
 
+    APW_stats stats;        // Statistics for the last parse
+
+    uint16_t stored = 0;    // APW_CUR_ or APW_DAY_ bits of the values stored by value()
+
+    // Progressive callbacks set by the sketch
+    CurrentCallback currentCallback = nullptr;
+    void           *currentContext  = nullptr;
+    DayCallback     dayCallback     = nullptr;
+    void           *dayContext      = nullptr;
+
+    Client     *transport = nullptr;           // Client set by sketch, nullptr = WiFiClient
+    const char *host      = "api.apixu.com";   // Server host name
+    uint16_t    port      = 80;                // Server port
+
+    // Request state, kept between poll() calls
+    APW_state    state        = APW_IDLE;
+    APW_error    requestError = APW_NO_ERROR;
+    Client      *client       = nullptr; // Transport used for the current request
+    WiFiClient   wifiClient;             // Default transport
+    JSON_Decoder parser;                 // Streaming parser, keeps state between polls
+    String       requestUrl;             // Url until the request has been sent
+    uint32_t     timeout      = 0;       // millis() when the request was sent
+    uint32_t     responseMs   = RESPONSE_TIMEOUT; // Limits set by setTimeouts()
+    uint32_t     completeMs   = COMPLETE_TIMEOUT;
+
+    // Connection reuse
+    bool         keepAlive    = false;   // Sketch has enabled connection reuse
+    bool         reuse        = false;   // Server will keep this connection open
+    bool         reused       = false;   // Request sent on a kept alive connection
+    String       lastUrl;                // Url resent if a kept connection was closed
+    bool         hostResolved = false;   // hostIP is valid
+    IPAddress    hostIP;                 // Cached server address
+
+    // HTTP response framing
+    bool         headerDone    = false;  // Header has been read
+    bool         statusSeen    = false;  // First header character has been checked
+    char         headerLine[48];         // Start of the header line being read
+    uint8_t      lineLength    = 0;      // Characters in headerLine
+    uint32_t     contentLength = 0;      // Body length, valid if lengthKnown
+    bool         lengthKnown   = false;  // Content-Length sent by the server
+    bool         chunked       = false;  // Transfer-Encoding: chunked
+    enum : uint8_t { CHUNK_SIZE, CHUNK_EXTENSION, CHUNK_DATA, CHUNK_DATA_END,
+                     CHUNK_TRAILER, CHUNK_DONE };
+    uint8_t      chunkState    = CHUNK_SIZE;
+    uint32_t     chunkLeft     = 0;      // Size, then data bytes left in the chunk
+
+    // Compressed responses
+    bool         compression   = false;  // Accept-Encoding sent
+    bool         encoded       = false;  // Content-Encoding gzip or deflate
+    bool         decodeFailed  = false;  // Inflate error
+    APW_Inflate *inflater      = nullptr;
+    uint8_t     *inflateWindow = nullptr;
+    uint32_t     bodyBytes     = 0;      // Body bytes received
+    bool         documentEnded = false;  // JSON document end has been parsed
+
     // Lookup table to convert  an array index to a weather icon bmp filename e.g. rain.bmp
 
     const char* iconList[MAX_ICON_INDEX + 1] = {"unknown", "rain", "sleet", "snow", "clear-day",
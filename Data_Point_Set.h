@@ -4,6 +4,56 @@
 
 // The content is zero or "" when first created.
 
+// Both unit sets are captured by one parse. The temp, wind, pressure and precip
+// values are in the units selected by setMetric(), the alt_ values hold the other
+// units and Apixu_Weather::applyUnits() swaps them when the selection changes.
+
+// Each parse compares the new values with those already stored and sets a "changed"
+// bit for every value that differs, so a sketch that keeps the structs between
+// requests can redraw only what has changed. The sketch clears the bits after the
+// redraw. The bits of the unit dependant values are also set by applyUnits().
+
+// If TEXT_FROM_CODE is defined in User_Setup.h the text Strings are not included, use
+// Apixu_Weather::conditionText() with the condition code to get the text.
+
+// Bits of APW_current::changed
+enum : uint16_t {
+  APW_CUR_COMPLETE    = 0,      // Callback only, the current values are all stored
+  APW_CUR_NAME        = 1 << 0,
+  APW_CUR_REGION      = 1 << 1,
+  APW_CUR_COUNTRY     = 1 << 2,
+  APW_CUR_LOCALTIME   = 1 << 3,
+  APW_CUR_UPDATED     = 1 << 4,
+  APW_CUR_TEXT        = 1 << 5,
+  APW_CUR_CODE        = 1 << 6,
+  APW_CUR_TEMP        = 1 << 7,
+  APW_CUR_WIND        = 1 << 8,
+  APW_CUR_WIND_DEGREE = 1 << 9,
+  APW_CUR_PRESSURE    = 1 << 10,
+  APW_CUR_PRECIP      = 1 << 11,
+  APW_CUR_HUMIDITY    = 1 << 12,
+  APW_CUR_CLOUD       = 1 << 13,
+  APW_CUR_CONDITION   = 1 << 14,
+  APW_CUR_IS_DAY      = 1 << 15,
+  APW_CUR_UNITS       = APW_CUR_TEMP | APW_CUR_WIND | APW_CUR_PRESSURE | APW_CUR_PRECIP
+};
+
+// Bits of APW_forecast::changed[day]
+enum : uint16_t {
+  APW_DAY_DATE        = 1 << 0,
+  APW_DAY_MAXTEMP     = 1 << 1,
+  APW_DAY_MINTEMP     = 1 << 2,
+  APW_DAY_PRECIP      = 1 << 3,
+  APW_DAY_TEXT        = 1 << 4,
+  APW_DAY_CODE        = 1 << 5,
+  APW_DAY_SUNRISE     = 1 << 6,
+  APW_DAY_SUNSET      = 1 << 7,
+  APW_DAY_MOONRISE    = 1 << 8,
+  APW_DAY_MOONSET     = 1 << 9,
+  APW_DAY_CONDITION   = 1 << 10,
+  APW_DAY_UNITS       = APW_DAY_MAXTEMP | APW_DAY_MINTEMP | APW_DAY_PRECIP
+};
+
 /***************************************************************************************
 ** Description:   Structure for current weather
 ***************************************************************************************/
@@ -14,8 +64,12 @@ typedef struct APW_current {
   uint32_t localtime_epoch = 0;
 
   uint32_t last_updated_epoch = 0;
+#ifndef TEXT_FROM_CODE
   String   text;
-  uint8_t  code = 0;
+#endif
+  uint16_t condition = 0;   // Apixu condition code
+  uint8_t  is_day = 0;      // 1 if daytime at the location
+  uint8_t  code = 0;        // Icon index
   float    temp = 0;
   float    wind = 0;
   uint16_t wind_degree = 0;
@@ -24,6 +78,14 @@ typedef struct APW_current {
   uint8_t  humidity = 0;
   uint8_t  cloud = 0;
 
+  float    alt_temp = 0;
+  float    alt_wind = 0;
+  float    alt_pressure = 0;
+  float    alt_precip = 0;
+  bool     metric = true; // Units of temp, wind, pressure and precip
+
+  uint16_t changed = 0;   // APW_CUR_ bits of the values changed, cleared by the sketch
+
 } APW_current;
 
 /***************************************************************************************
@@ -35,11 +97,157 @@ typedef struct APW_forecast {
   float    maxtemp[MAX_DAYS] = { 0 };
   float    mintemp[MAX_DAYS] = { 0 };
   float    totalprecip[MAX_DAYS] = { 0 };
+#ifndef TEXT_FROM_CODE
   String   text[MAX_DAYS];
-  uint8_t  code[MAX_DAYS] = { 0 };
+#endif
+  uint16_t condition[MAX_DAYS] = { 0 }; // Apixu condition code
+  uint8_t  code[MAX_DAYS] = { 0 };      // Icon index
   String   sunrise[MAX_DAYS];
   String   sunset[MAX_DAYS];
   String   moonrise[MAX_DAYS];
   String   moonset[MAX_DAYS];
 
+  float    alt_maxtemp[MAX_DAYS] = { 0 };
+  float    alt_mintemp[MAX_DAYS] = { 0 };
+  float    alt_totalprecip[MAX_DAYS] = { 0 };
+  bool     metric = true; // Units of maxtemp, mintemp and totalprecip
+
+  uint16_t changed[MAX_DAYS] = { 0 }; // APW_DAY_ bits for each day, cleared by the sketch
+
 } APW_forecast;
+
+/***************************************************************************************
+** Description:   Compact structures, fixed size with no heap use
+***************************************************************************************/
+// An alternative to APW_current and APW_forecast that can be allocated statically and
+// copied with memcpy. Temperatures, speeds, pressures and rainfall are fixed point
+// metric values in tenths, use the APW_to...() functions below to convert. Times are
+// minutes since local midnight (APW_NO_TIME if none, e.g. "No moonrise"). The weather
+// text is not stored, condition holds the Apixu condition code e.g. 1003.
+
+#ifndef LOCATION_LENGTH
+  #define LOCATION_LENGTH 24 // Characters kept for the name, region and country
+#endif
+
+#define APW_NO_TIME 0xFFFF
+
+// 96 bytes with the default LOCATION_LENGTH
+typedef struct APW_current_compact {
+  char     name[LOCATION_LENGTH]    = { 0 }; // Truncated if longer
+  char     region[LOCATION_LENGTH]  = { 0 };
+  char     country[LOCATION_LENGTH] = { 0 };
+  uint32_t localtime_epoch = 0;
+
+  uint32_t last_updated_epoch = 0;
+  uint16_t condition = 0;   // Apixu condition code
+  uint8_t  code = 0;        // Icon index
+  int16_t  temp = 0;        // deg.C x 10
+  uint16_t wind = 0;        // kph x 10
+  uint16_t wind_degree = 0;
+  uint16_t pressure = 0;    // mb x 10
+  uint16_t precip = 0;      // mm x 10
+  uint8_t  humidity = 0;
+  uint8_t  cloud = 0;
+
+} APW_current_compact;
+
+// 24 bytes per day
+typedef struct APW_day_compact {
+  uint32_t date_epoch = 0;
+  int16_t  maxtemp = 0;     // deg.C x 10
+  int16_t  mintemp = 0;     // deg.C x 10
+  uint16_t totalprecip = 0; // mm x 10
+  uint16_t condition = 0;   // Apixu condition code
+  uint16_t sunrise = APW_NO_TIME;  // Minutes since midnight
+  uint16_t sunset = APW_NO_TIME;
+  uint16_t moonrise = APW_NO_TIME;
+  uint16_t moonset = APW_NO_TIME;
+  uint8_t  code = 0;        // Icon index
+} APW_day_compact;
+
+// Days is the number of forecast days requested, in range 1 - 7
+template <uint8_t Days>
+struct APW_forecast_compact {
+  static_assert(Days >= 1 && Days <= 7, "Forecast days must be in range 1 - 7");
+  static const uint8_t days = Days;
+  APW_day_compact day[Days];
+};
+
+// Fixed point to float conversions, the x 10 metric values to metric or imperial
+inline float APW_toFloat(int32_t tenths)            { return tenths * 0.1f; }
+inline float APW_toFahrenheit(int16_t celsius10)    { return celsius10 * 0.18f + 32.0f; }
+inline float APW_toMph(uint16_t kph10)              { return kph10 * 0.0621371f; }
+inline float APW_toInHg(uint16_t mb10)              { return mb10 * 0.00295300f; }
+inline float APW_toInches(uint16_t mm10)            { return mm10 * 0.00393701f; }
+
+/***************************************************************************************
+** Description:   Hourly forecast store, a fixed size ring buffer
+***************************************************************************************/
+// Hourly values are quantized so each hour takes 12 bytes, an APW_hourly<24> takes
+// 300 bytes and an APW_hourly<48> 588 bytes. The records are allocated once with the
+// store and filled during the parse with no heap use.
+
+typedef struct APW_hour {
+  uint32_t time_epoch = 0;     // Start of the hour
+  int16_t  temp = 0;           // deg.C x 10
+  uint16_t precip = 0;         // mm x 10
+  uint8_t  wind = 0;           // kph, limited to 255
+  uint8_t  wind_dir = 0;       // degrees / 2
+  uint8_t  code = 0;           // Icon index
+  uint8_t  chance_of_rain = 0; // %
+} APW_hour;
+
+// Access to the records, independent of the store size
+class APW_hourly_ring {
+
+  public:
+    // Number of hours stored
+    uint16_t count(void) { return used; }
+    bool     full(void)  { return used >= size; }
+
+    // Hour i counted from the earliest stored, i must be less than count()
+    APW_hour& operator[](uint16_t i) { return record[(first + i) % size]; }
+
+    // Drop the hours that ended before an epoch time (e.g. the time now) so the
+    // stored window moves on without a new request
+    void expire(uint32_t epoch)
+    {
+      while (used && record[first].time_epoch + 3600 <= epoch)
+      {
+        first = (first + 1) % size;
+        used--;
+      }
+    }
+
+    void clear(void) { first = 0; used = 0; }
+
+    // Used by the parser, returns the next free record or nullptr if full
+    APW_hour* add(void)
+    {
+      if (full()) return nullptr;
+      APW_hour *hour = &record[(first + used++) % size];
+      *hour = APW_hour();
+      return hour;
+    }
+
+  protected:
+    APW_hourly_ring(APW_hour *record, uint16_t size) : record(record), size(size) { }
+
+  private:
+    APW_hour *record;
+    uint16_t  size;
+    uint16_t  first = 0; // Index of the earliest hour
+    uint16_t  used  = 0; // Hours stored
+};
+
+// Hours is the window size, e.g. 24 for the next 24 hours
+template <uint16_t Hours>
+class APW_hourly : public APW_hourly_ring {
+
+  public:
+    APW_hourly() : APW_hourly_ring(hours, Hours) { }
+    APW_hourly(const APW_hourly&) = delete; // The ring points at its own records
+
+  private:
+    APW_hour hours[Hours];
+};
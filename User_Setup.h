@@ -6,5 +6,29 @@
 
 #define MAX_DAYS 7    // Maximum day count for the forecast, use a value in range 1 - 7
 
+// The response is read from the WiFi client in blocks of this many bytes, each block is
+// fed to the parser in one loop. The buffer is on the stack during the request.
+#define READ_BUFFER_SIZE 256
+
+// Buffer used to decode compressed responses when setCompression(true) is called, a
+// power of 2, default 32768, 8192 on the ESP8266. The server can refer back up to
+// 32768 bytes and the forecast days repeat about 24000 bytes apart, so with a smaller
+// window setCompression(true) returns false. Set 32768 here to use compression on
+// the ESP8266.
+//#define INFLATE_WINDOW 32768
+
+// Get the weather condition text from the condition code with conditionText() rather
+// than store the text sent by the server. The text Strings are removed from the structs
+// and the text values are skipped by the parser, saving RAM and parse time.
+//#define TEXT_FROM_CODE
+
+// Language of the conditionText() text, a copy of APW_Conditions_en.h with the text
+// translated. Default is English.
+//#define CONDITION_TEXT_FILE "APW_Conditions_en.h"
+
+// Print the request progress and statistics to the serial port, comment out for none.
+// The statistics can always be read by the sketch with getStats()
+#define SHOW_REQUEST
+
 //#define SHOW_JSON     // Debug only - simple serial output formatting of whole JSON message
 //#define SHOW_CALLBACK // Debug only - to show when the callbacks occur
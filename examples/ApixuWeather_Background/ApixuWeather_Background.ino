@@ -0,0 +1,104 @@
+// Sketch for ESP32 to fetch the weather from Apixu on the other core
+// an example from the library here:
+// https://github.com/Bodmer/ApixuWeather
+
+// Sign up for a key and read API configuration info here:
+// http://api.apixu.com
+
+// The requests and the parsing are done by an APW_Background task on core 0, so loop()
+// never waits for the network. loop() takes the latest values with update() and only
+// prints the values that have changed, here it also counts the loops run each second.
+
+#ifndef ESP32
+  #error "APW_Background needs the second core of an ESP32"
+#endif
+
+#include <WiFi.h>
+
+#include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
+
+#include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+#include <APW_Background.h>
+
+// =====================================================
+// ========= User configured stuff starts here =========
+// Further configuration settings can be found in the
+// ApixuWeather library "User_Setup.h" file
+
+// Change to suit your WiFi router
+#define SSID "Your_SSID"
+#define SSID_PASSWORD "Your_password"
+
+// Apixu API Details, replace x's with your API key
+String api_key = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"; // Obtain this from your Apixu account
+
+// Set location to nearest city, zip code, post code, latitude & longitude etc
+String loc =  "New%20York"; // No spaces allowed, use %20 for spaces
+
+// =========  User configured stuff ends here  =========
+// =====================================================
+
+Apixu_Weather apw; // Weather forecast library instance, used only by the task
+
+APW_Background background(apw); // Fetch task
+
+uint32_t loops = 0;
+uint32_t second = 0;
+
+/***************************************************************************************
+**                          setup
+***************************************************************************************/
+void setup() {
+  Serial.begin(250000);
+
+  Serial.printf("Connecting to %s\n", SSID);
+  WiFi.begin(SSID, SSID_PASSWORD);
+  while (WiFi.status() != WL_CONNECTED) delay(100);
+  Serial.println("Connected");
+
+  apw.setMetric(true); // Set before begin(), the task then owns apw
+
+  if (!background.begin(api_key, loc)) Serial.println("Task not started");
+}
+
+/***************************************************************************************
+**                          loop
+***************************************************************************************/
+void loop() {
+
+  // Returns at once, true when the task has published newer values
+  if (background.update())
+  {
+    APW_current *current = background.current();
+
+    if (current->changed & APW_CUR_TEMP) {
+      Serial.print("temp               : "); Serial.println(current->temp);
+    }
+    if (current->changed & APW_CUR_HUMIDITY) {
+      Serial.print("humidity           : "); Serial.println(current->humidity);
+    }
+    if (current->changed & APW_CUR_WIND) {
+      Serial.print("wind speed         : "); Serial.println(current->wind);
+    }
+    if (current->changed & APW_CUR_CONDITION) {
+      Serial.print("text               : "); Serial.println(apw.conditionText(current->condition, current->is_day));
+    }
+
+    APW_forecast *forecast = background.forecast();
+    for (uint8_t i = 0; i < MAX_DAYS; i++)
+    {
+      if (forecast->changed[i] & APW_DAY_MAXTEMP) {
+        Serial.printf("day %u max temp    : ", i); Serial.println(forecast->maxtemp[i]);
+      }
+    }
+  }
+
+  // The display, buttons etc would be served here without waiting for the network
+  loops++;
+  if (millis() - second >= 1000)
+  {
+    second += 1000;
+    if (loops < 1000) Serial.printf("Only %u loops in the last second\n", loops);
+    loops = 0;
+  }
+}
@@ -0,0 +1,145 @@
+// Sketch for ESP32 or ESP8266 to fetch the forecast for several locations at once
+// an example from the library here:
+// https://github.com/Bodmer/ApixuWeather
+
+// The locations are first fetched one after another with getForecast() and then as
+// a batch with up to BATCH_CONNECTIONS requests in flight. The wall time of both is
+// reported for 1 to LOCATIONS locations, so the scaling can be measured. Point
+// SERVER_HOST at a local stand-in server serving a recorded response to measure the
+// library rather than the internet.
+
+// Choose the WiFi library to load depending on the selected processor
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else // ESP32
+  #include <WiFi.h>
+#endif
+
+#include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
+
+#include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+
+#include <APW_Batch.h>
+
+// =====================================================
+// ========= User configured stuff starts here =========
+
+// Change to suit your WiFi router
+#define SSID "Your_SSID"
+#define SSID_PASSWORD "Your_password"
+
+// Server to fetch from, e.g. "192.168.1.10" and 8080 for a local stand-in server
+#define SERVER_HOST "api.apixu.com"
+#define SERVER_PORT 80
+
+// Apixu API Details, replace x's with your API key
+String api_key = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"; // Obtain this from your Apixu account
+
+#define LOCATIONS 6
+String city[LOCATIONS] = { "London", "Paris", "New%20York", "Tokyo", "Sydney", "Cairo" };
+
+// =========  User configured stuff ends here  =========
+// =====================================================
+
+Apixu_Weather apw;   // Single connection for the serial requests
+APW_Batch     batch; // BATCH_CONNECTIONS connections
+
+APW_location location[LOCATIONS];
+
+/***************************************************************************************
+**                          setup
+***************************************************************************************/
+void setup() {
+  Serial.begin(250000);
+
+  Serial.printf("Connecting to %s\n", SSID);
+
+  WiFi.begin(SSID, SSID_PASSWORD);
+
+  while (WiFi.status() != WL_CONNECTED) {
+      delay(500);
+      Serial.print(".");
+  }
+
+  Serial.println();
+  Serial.print("Connected\n");
+
+  apw.setServer(SERVER_HOST, SERVER_PORT);
+  batch.setServer(SERVER_HOST, SERVER_PORT);
+
+  for (int i = 0; i < LOCATIONS; i++) location[i].city = city[i];
+}
+
+/***************************************************************************************
+**                          loop
+***************************************************************************************/
+void loop() {
+
+  Serial.println("locations, serial ms, batch ms");
+
+  for (int n = 1; n <= LOCATIONS; n++)
+  {
+    uint32_t serialTime = fetchSerial(n);
+    uint32_t batchTime  = fetchBatch(n);
+
+    Serial.print(n); Serial.print(", ");
+    Serial.print(serialTime); Serial.print(", ");
+    Serial.println(batchTime);
+  }
+
+  delay(5UL * 60UL * 1000UL); // Every 5 minutes
+}
+
+/***************************************************************************************
+**                          Fetch n locations one after another
+***************************************************************************************/
+uint32_t fetchSerial(int n)
+{
+  uint32_t dt = millis();
+
+  for (int i = 0; i < n; i++)
+  {
+    APW_current  *current  = new APW_current;
+    APW_forecast *forecast = new APW_forecast;
+
+    if (!apw.getForecast(current, forecast, api_key, city[i]))
+    {
+      Serial.print("Serial fetch failed: "); Serial.println(city[i]);
+    }
+
+    delete current;
+    delete forecast;
+  }
+
+  return millis() - dt;
+}
+
+/***************************************************************************************
+**                          Fetch n locations as a batch
+***************************************************************************************/
+uint32_t fetchBatch(int n)
+{
+  for (int i = 0; i < n; i++)
+  {
+    location[i].current  = new APW_current;
+    location[i].forecast = new APW_forecast;
+  }
+
+  uint32_t dt = millis();
+  batch.getForecastBatch(location, n, api_key);
+  dt = millis() - dt;
+
+  for (int i = 0; i < n; i++)
+  {
+    if (location[i].state != APW_DONE)
+    {
+      Serial.print("Batch fetch failed: "); Serial.print(city[i]);
+      Serial.print(" error "); Serial.println(location[i].error);
+    }
+
+    delete location[i].current;
+    delete location[i].forecast;
+  }
+
+  return dt;
+}
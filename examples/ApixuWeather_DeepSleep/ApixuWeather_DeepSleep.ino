@@ -0,0 +1,146 @@
+// Sketch for ESP32 or ESP8266 to show the weather from Apixu between deep sleeps
+// an example from the library here:
+// https://github.com/Bodmer/ApixuWeather
+
+// Sign up for a key and read API configuration info here:
+// http://api.apixu.com
+
+// The parsed weather is saved as a snapshot in RTC memory, which keeps its content
+// during a deep sleep. After a wake the weather is restored from the snapshot in a
+// few microseconds and shown at once. The scheduler, also kept in RTC memory, sets the
+// sleep time so WiFi is only started when the server will have newer values.
+
+// Choose the WiFi library to load depending on the selected processor
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else // ESP32
+  #include <WiFi.h>
+#endif
+
+#include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
+
+#include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+#include <APW_Scheduler.h>
+
+// =====================================================
+// ========= User configured stuff starts here =========
+// Further configuration settings can be found in the
+// ApixuWeather library "User_Setup.h" file
+
+// Change to suit your WiFi router
+#define SSID "Your_SSID"
+#define SSID_PASSWORD "Your_password"
+
+// Apixu API Details, replace x's with your API key
+String api_key = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"; // Obtain this from your Apixu account
+
+// Set location to nearest city, zip code, post code, latitude & longitude etc
+String loc =  "New%20York"; // No spaces allowed, use %20 for spaces
+
+// =========  User configured stuff ends here  =========
+// =====================================================
+
+Apixu_Weather apw; // Weather forecast library instance
+
+// RTC memory content: a marker, the scheduler, the time slept, the snapshot length and
+// the snapshot. The ESP8266 RTC user memory is 512 bytes read in 4 byte words.
+#define RTC_MARKER 0x41505731
+
+typedef struct {
+  uint32_t marker;
+  APW_Scheduler schedule;
+  uint32_t slept;
+  uint32_t length;
+  uint32_t snapshot[(APW_SNAPSHOT_SIZE + 3) / 4];
+} rtc_store;
+
+#ifdef ESP8266
+  rtc_store rtc;
+#else
+  RTC_DATA_ATTR rtc_store rtc;
+#endif
+
+/***************************************************************************************
+**                          setup
+***************************************************************************************/
+void setup() {
+  Serial.begin(250000);
+  Serial.println();
+
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  apw.setMetric(true); // mm rain, deg.C, millibars (hPa) pressure, kph
+
+#ifdef ESP8266
+  ESP.rtcUserMemoryRead(0, (uint32_t *)&rtc, sizeof(rtc));
+#endif
+
+  // The RTC memory content is random after power up
+  if (rtc.marker != RTC_MARKER)
+  {
+    rtc.marker   = RTC_MARKER;
+    rtc.schedule = APW_Scheduler();
+    rtc.slept    = 0;
+    rtc.length   = 0;
+  }
+
+  rtc.schedule.wake(rtc.slept);
+
+  // The snapshot is checked, there is none until the first successful fetch
+  if (apw.loadSnapshot((uint8_t *)rtc.snapshot, rtc.length, current, forecast))
+  {
+    Serial.println("Restored from snapshot");
+    printWeather(current);
+  }
+
+  if (rtc.schedule.due())
+  {
+    Serial.printf("Connecting to %s\n", SSID);
+    WiFi.begin(SSID, SSID_PASSWORD);
+    while (WiFi.status() != WL_CONNECTED) delay(100);
+
+    if (apw.getForecast(current, forecast, api_key, loc))
+    {
+      // Only the values that have changed since the snapshot need to be redrawn
+      if (current->changed) printWeather(current);
+      rtc.length = apw.saveSnapshot((uint8_t *)rtc.snapshot, sizeof(rtc.snapshot), current, forecast);
+      rtc.schedule.fetched(current);
+    }
+    else rtc.schedule.failed();
+  }
+
+  // Sleep until the server will have new values, at least a minute
+  rtc.slept = rtc.schedule.sleepSeconds();
+  if (rtc.slept < 60) rtc.slept = 60;
+
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(0, (uint32_t *)&rtc, sizeof(rtc));
+#endif
+
+  delete current;
+  delete forecast;
+
+  Serial.print("Sleeping for "); Serial.print(rtc.slept); Serial.println("s");
+  ESP.deepSleep(rtc.slept * 1000000ULL);
+}
+
+/***************************************************************************************
+**                          loop
+***************************************************************************************/
+void loop() {
+  // Not used, the sketch restarts from setup() after each deep sleep
+}
+
+/***************************************************************************************
+**                          Send weather info to serial port
+***************************************************************************************/
+void printWeather(APW_current *current)
+{
+  Serial.print("name               : "); Serial.println(current->name);
+  Serial.print("text               : "); Serial.println(apw.conditionText(current->condition, current->is_day));
+  Serial.print("temp               : "); Serial.println(current->temp);
+  Serial.print("humidity           : "); Serial.println(current->humidity);
+  Serial.print("wind speed         : "); Serial.println(current->wind);
+  Serial.println();
+}
@@ -0,0 +1,119 @@
+// Sketch for ESP32 or ESP8266 to keep a daily weather history in LittleFS
+// an example from the library here:
+// https://github.com/Bodmer/ApixuWeather
+
+// Recorded forecast.json or history.json responses in the /archive folder of LittleFS
+// are replayed through the parser, without a network, and the first day of each is
+// added to an APW_History store. The files must list in date order, e.g. named by
+// date, as days are only appended. The stored days are then summarised.
+
+// A sketch that fetches the weather would call history.add(forecast.day[0]) after
+// each successful compact getForecast(), only one day per date is stored.
+
+// Choose the WiFi and file system libraries to load depending on the selected processor
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else // ESP32
+  #include <WiFi.h>
+#endif
+
+#include <LittleFS.h>
+
+#include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
+
+#include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+#include <APW_History.h>
+#include <APW_ReplayClient.h>
+
+Apixu_Weather apw; // Weather forecast library instance
+
+APW_History history(LittleFS, "/ny"); // Daily history for one location
+
+/***************************************************************************************
+**                          setup
+***************************************************************************************/
+void setup() {
+  Serial.begin(250000);
+  Serial.println();
+
+#ifdef ESP8266
+  if (!LittleFS.begin()) { Serial.println("LittleFS mount failed"); return; }
+#else
+  if (!LittleFS.begin(true)) { Serial.println("LittleFS mount failed"); return; }
+#endif
+
+  uint32_t added = 0, skipped = 0;
+  uint32_t dt = millis();
+
+#ifdef ESP8266
+  Dir dir = LittleFS.openDir("/archive");
+  while (dir.next())
+  {
+    File file = dir.openFile("r");
+    if (ingest(file)) added++; else skipped++;
+    file.close();
+  }
+#else
+  File dir = LittleFS.open("/archive");
+  File file;
+  while (dir && (file = dir.openNextFile()))
+  {
+    if (ingest(file)) added++; else skipped++;
+    file.close();
+  }
+#endif
+
+  Serial.printf("Added %u days, skipped %u files in %lu ms\n", added, skipped, millis() - dt);
+  Serial.printf("%u days stored\n\n", history.count());
+
+  APW_day_compact last;
+  if (!history.read(history.count() - 1, &last)) return;
+
+  // The last 7, 30 and 365 days up to the last day stored, and all the days
+  printSummary("week",  last.date_epoch - 6 * 86400UL,   last.date_epoch);
+  printSummary("month", last.date_epoch - 29 * 86400UL,  last.date_epoch);
+  printSummary("year",  last.date_epoch - 364 * 86400UL, last.date_epoch);
+  printSummary("all",   0, 0xFFFFFFFF);
+}
+
+/***************************************************************************************
+**                          loop
+***************************************************************************************/
+void loop() {
+}
+
+/***************************************************************************************
+**                          Add the first day of a recorded response
+***************************************************************************************/
+bool ingest(File &file)
+{
+  APW_ReplayClient replay(file);
+  APW_current_compact current;
+  APW_forecast_compact<1> forecast;
+
+  apw.setClient(&replay);
+  bool ok = apw.getForecast(&current, &forecast, "", "");
+  apw.setClient(nullptr);
+
+  return ok && history.add(forecast.day[0]);
+}
+
+/***************************************************************************************
+**                          Send a summary to the serial port
+***************************************************************************************/
+void printSummary(const char *name, uint32_t from, uint32_t to)
+{
+  APW_history_summary s;
+
+  uint32_t dt = micros();
+  if (!history.summary(from, to, &s)) { Serial.println("Read failed"); return; }
+  dt = micros() - dt;
+
+  Serial.printf("%-5s %4u days in %lu us\n", name, s.days, dt);
+  if (!s.days) return;
+  Serial.print("  highest max temp : "); Serial.println(APW_toFloat(s.maxtemp));
+  Serial.print("  lowest min temp  : "); Serial.println(APW_toFloat(s.mintemp));
+  Serial.print("  mean max temp    : "); Serial.println(APW_toFloat(s.mean_maxtemp));
+  Serial.print("  mean min temp    : "); Serial.println(APW_toFloat(s.mean_mintemp));
+  Serial.print("  total precip mm  : "); Serial.println(APW_toFloat(s.totalprecip));
+}
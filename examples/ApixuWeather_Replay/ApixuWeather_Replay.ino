@@ -0,0 +1,192 @@
+// Sketch for ESP32 or ESP8266 to benchmark the Apixu parser without a network
+// an example from the library here:
+// https://github.com/Bodmer/ApixuWeather
+
+// A recorded forecast.json message held in PROGMEM is fed to the same JSON_Decoder
+// and key()/value() callbacks used for a live request. The parse statistics are
+// reported and the extracted values are checked against the golden values in
+// forecast_sample.h, so parser changes can be compared on real numbers.
+
+// The checks of each library feature, e.g. units, compact structures, compression,
+// snapshots, buffered parsing and network links, are run on a PC by the tests in
+// extras/test, this sketch shows the replay on the target processor.
+
+// Choose the WiFi library to load depending on the selected processor
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else // ESP32
+  #include <WiFi.h>
+#endif
+
+#include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
+
+#include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+
+#include <APW_ReplayClient.h>
+
+#include "forecast_sample.h" // Recorded message and golden values
+
+Apixu_Weather apw; // Weather forecast library instance
+
+// Client that serves the recorded message, used to time the full request loop
+APW_ReplayClient replayClient(forecast_json);
+
+uint16_t failCount = 0; // Golden value mismatch count
+
+/***************************************************************************************
+**                          setup
+***************************************************************************************/
+void setup() {
+  Serial.begin(250000);
+
+  // The radio is not needed, turn it off so it does not disturb the timing
+  WiFi.mode(WIFI_OFF);
+
+  Serial.println();
+}
+
+/***************************************************************************************
+**                          loop
+***************************************************************************************/
+void loop() {
+
+  apw.setMetric(true); // mm rain, deg.C, millibars (hPa) pressure, kph
+  replayWeather(true);
+
+  apw.setMetric(false); // inches rain, deg.F, inches pressure, mph
+  replayWeather(false);
+
+  delay(10000);
+}
+
+/***************************************************************************************
+**                          Replay the recorded message and report
+***************************************************************************************/
+void replayWeather(bool metric)
+{
+  // Create the structures that hold the retrieved weather
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  failCount = 0;
+
+  bool ok = apw.replayForecast(current, forecast, forecast_json);
+
+  const APW_stats& stats = apw.getStats();
+
+  Serial.println(metric ? "############### Metric replay   ###############" :
+                          "############### Imperial replay ###############");
+
+  Serial.print("parse ok           : "); Serial.println(ok ? "yes" : "no");
+  Serial.print("bytes              : "); Serial.println(stats.bytes);
+  Serial.print("key callbacks      : "); Serial.println(stats.keys);
+  Serial.print("value callbacks    : "); Serial.println(stats.values);
+  Serial.print("String stores      : "); Serial.println(stats.stores);
+  Serial.print("skipped bytes      : "); Serial.println(stats.skipped);
+  Serial.print("parse time us      : "); Serial.println(stats.parse_us);
+  Serial.print("callback time us   : "); Serial.println(stats.callback_us);
+
+  uint32_t us = stats.parse_us ? stats.parse_us : 1;
+  Serial.print("bytes/s            : "); Serial.println((uint32_t)(stats.bytes * 1000000.0 / us));
+  Serial.print("callbacks/s        : "); Serial.println((uint32_t)((stats.keys + stats.values) * 1000000.0 / us));
+  Serial.print("free heap start    : "); Serial.println(stats.heap_start);
+  Serial.print("free heap minimum  : "); Serial.println(stats.heap_min);
+  Serial.print("free heap end      : "); Serial.println(stats.heap_end);
+  Serial.print("peak heap used     : "); Serial.println(stats.heap_start - stats.heap_min);
+
+  checkGolden(current, forecast, metric);
+
+  Serial.print("golden check       : ");
+  if (failCount) { Serial.print(failCount); Serial.println(" FAILED"); }
+  else Serial.println("passed");
+  Serial.println();
+
+  // Delete to free up space and prevent fragmentation as strings change in length
+  delete current;
+  delete forecast;
+
+  replayRequest();
+}
+
+/***************************************************************************************
+**                          Check the extracted values against the golden values
+***************************************************************************************/
+void checkGolden(APW_current *current, APW_forecast *forecast, bool metric)
+{
+  uint8_t u = metric ? 0 : 1;
+
+  checkValue("temp",     current->temp,     golden_temp[u]);
+  checkValue("wind",     current->wind,     golden_wind[u]);
+  checkValue("pressure", current->pressure, golden_pressure[u]);
+  checkValue("precip",   current->precip,   golden_precip[u]);
+  checkText ("current condition", apw.conditionText(current->condition, current->is_day), "Partly cloudy");
+
+  for (int i = 0; i < MAX_DAYS && i < GOLDEN_DAYS; i++)
+  {
+    checkValue("date_epoch",  forecast->date_epoch[i],  golden_date_epoch[i]);
+    checkValue("maxtemp",     forecast->maxtemp[i],     golden_maxtemp[u][i]);
+    checkValue("mintemp",     forecast->mintemp[i],     golden_mintemp[u][i]);
+    checkValue("totalprecip", forecast->totalprecip[i], golden_totalprecip[u][i]);
+#ifndef TEXT_FROM_CODE
+    checkText ("text",        forecast->text[i],        golden_text[i]);
+#endif
+    checkText ("condition",   apw.conditionText(forecast->condition[i]), golden_text[i]);
+    checkText ("sunrise",     forecast->sunrise[i],     golden_sunrise[i]);
+    checkText ("moonset",     forecast->moonset[i],     golden_moonset[i]);
+  }
+}
+
+/***************************************************************************************
+**                          Replay through the complete request loop
+***************************************************************************************/
+// The library request loop is run with the replay client as the transport, so the
+// time includes the block reads from the client but no network delays
+void replayRequest()
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  apw.setClient(&replayClient);
+
+  uint32_t dt = micros();
+  bool ok = apw.getForecast(current, forecast, "key", "New%20York");
+  dt = micros() - dt;
+
+  apw.setClient(nullptr); // Back to the WiFiClient
+
+  Serial.print("request loop ok    : "); Serial.println(ok ? "yes" : "no");
+  Serial.print("request loop us    : "); Serial.println(dt);
+  Serial.print("wire bytes         : "); Serial.println(apw.getStats().bytes);
+  Serial.print("request bytes      : "); Serial.println(replayClient.requestLength());
+  Serial.println();
+
+  delete current;
+  delete forecast;
+}
+
+/***************************************************************************************
+**                          Compare with golden values
+***************************************************************************************/
+void checkValue(const char* name, float value, float golden)
+{
+  if (fabs(value - golden) < 0.001) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print(value); Serial.print(" expected "); Serial.println(golden);
+}
+
+void checkValue(const char* name, uint32_t value, uint32_t golden)
+{
+  if (value == golden) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print(value); Serial.print(" expected "); Serial.println(golden);
+}
+
+void checkText(const char* name, String value, const char* golden)
+{
+  if (value == golden) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print(value); Serial.print(" expected "); Serial.println(golden);
+}
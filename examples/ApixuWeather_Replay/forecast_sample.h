@@ -0,0 +1,110 @@
+// Recorded Apixu forecast.json response for New York, 3 days with hourly data,
+// as returned for: http://api.apixu.com/v1/forecast.json?key=xxx&q=New%20York&days=3
+
+// Line breaks have been added between objects for readability, the JSON is otherwise
+// identical to the server response. Both metric and imperial values are present.
+
+const char forecast_json[] PROGMEM = R"=====({"location":{"name":"New York","region":"New York","country":"United States of America","lat":40.71,"lon":-74.01,"tz_id":"America/New_York","localtime_epoch":1541865032,"localtime":"2018-11-10 10:50"},
+"current":{"last_updated_epoch":1541864712,"last_updated":"2018-11-10 10:45","temp_c":4.4,"temp_f":39.9,"is_day":1,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/day/116.png","code":1003},"wind_mph":13.6,"wind_kph":22.0,"wind_degree":290,"wind_dir":"WNW","pressure_mb":1012.0,"pressure_in":30.4,"precip_mm":0.1,"precip_in":0.0,"humidity":53,"cloud":50,"feelslike_c":-0.3,"feelslike_f":31.5,"vis_km":16.0,"vis_miles":9.0,"uv":3.0},
+"forecast":{"forecastday":[
+{"date":"2018-11-10","date_epoch":1541808000,"day":{"maxtemp_c":6.5,"maxtemp_f":43.7,"mintemp_c":-1.9,"mintemp_f":28.6,"avgtemp_c":2.3,"avgtemp_f":36.1,"maxwind_mph":18.1,"maxwind_kph":29.2,"totalprecip_mm":4.4,"totalprecip_in":0.17,"avgvis_km":17.0,"avgvis_miles":10.0,"avghumidity":61.0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/day/116.png","code":1003},"uv":1.6},"astro":{"sunrise":"06:35 AM","sunset":"04:42 PM","moonrise":"09:42 AM","moonset":"07:02 PM"},"hour":[
+{"time_epoch":1541826000,"time":"2018-11-10 00:00","temp_c":-1.0,"temp_f":30.2,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":5.9,"wind_kph":9.5,"wind_degree":274,"wind_dir":"WNW","pressure_mb":1010.3,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":46,"cloud":46,"feelslike_c":-4.0,"feelslike_f":24.8,"windchill_c":-4.0,"windchill_f":24.8,"heatindex_c":-1.0,"heatindex_f":30.2,"dewpoint_c":-7.0,"dewpoint_f":19.4,"will_it_rain":0,"chance_of_rain":"74","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.9,"gust_kph":14.2},
+{"time_epoch":1541829600,"time":"2018-11-10 01:00","temp_c":-1.9,"temp_f":28.6,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":8.1,"wind_kph":13.1,"wind_degree":35,"wind_dir":"WNW","pressure_mb":1009.1,"pressure_in":29.8,"precip_mm":0.0,"precip_in":0.0,"humidity":55,"cloud":11,"feelslike_c":-4.9,"feelslike_f":23.2,"windchill_c":-4.9,"windchill_f":23.2,"heatindex_c":-1.9,"heatindex_f":28.6,"dewpoint_c":-7.9,"dewpoint_f":17.8,"will_it_rain":0,"chance_of_rain":"70","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.2,"gust_kph":19.6},
+{"time_epoch":1541833200,"time":"2018-11-10 02:00","temp_c":-1.9,"temp_f":28.5,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":10.1,"wind_kph":16.3,"wind_degree":321,"wind_dir":"WNW","pressure_mb":1009.2,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":77,"cloud":7,"feelslike_c":-4.9,"feelslike_f":23.1,"windchill_c":-4.9,"windchill_f":23.1,"heatindex_c":-1.9,"heatindex_f":28.5,"dewpoint_c":-7.9,"dewpoint_f":17.7,"will_it_rain":0,"chance_of_rain":"73","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.2,"gust_kph":24.5},
+{"time_epoch":1541836800,"time":"2018-11-10 03:00","temp_c":-1.9,"temp_f":28.6,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":5.3,"wind_kph":8.5,"wind_degree":68,"wind_dir":"WNW","pressure_mb":1009.4,"pressure_in":29.8,"precip_mm":0.2,"precip_in":0.01,"humidity":58,"cloud":53,"feelslike_c":-4.9,"feelslike_f":23.2,"windchill_c":-4.9,"windchill_f":23.2,"heatindex_c":-1.9,"heatindex_f":28.6,"dewpoint_c":-7.9,"dewpoint_f":17.8,"will_it_rain":0,"chance_of_rain":"18","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":7.9,"gust_kph":12.8},
+{"time_epoch":1541840400,"time":"2018-11-10 04:00","temp_c":-1.8,"temp_f":28.7,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":8.5,"wind_kph":13.7,"wind_degree":52,"wind_dir":"WNW","pressure_mb":1010.1,"pressure_in":29.8,"precip_mm":0.4,"precip_in":0.02,"humidity":77,"cloud":73,"feelslike_c":-4.8,"feelslike_f":23.3,"windchill_c":-4.8,"windchill_f":23.3,"heatindex_c":-1.8,"heatindex_f":28.7,"dewpoint_c":-7.8,"dewpoint_f":17.9,"will_it_rain":1,"chance_of_rain":"81","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.8,"gust_kph":20.5},
+{"time_epoch":1541844000,"time":"2018-11-10 05:00","temp_c":-1.8,"temp_f":28.8,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":5.6,"wind_kph":9.0,"wind_degree":316,"wind_dir":"WNW","pressure_mb":1010.4,"pressure_in":29.8,"precip_mm":0.2,"precip_in":0.01,"humidity":53,"cloud":63,"feelslike_c":-4.8,"feelslike_f":23.4,"windchill_c":-4.8,"windchill_f":23.4,"heatindex_c":-1.8,"heatindex_f":28.8,"dewpoint_c":-7.8,"dewpoint_f":18.0,"will_it_rain":0,"chance_of_rain":"87","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.4,"gust_kph":13.5},
+{"time_epoch":1541847600,"time":"2018-11-10 06:00","temp_c":-0.8,"temp_f":30.6,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":9.8,"wind_kph":15.8,"wind_degree":185,"wind_dir":"WNW","pressure_mb":1009.9,"pressure_in":29.8,"precip_mm":0.7,"precip_in":0.03,"humidity":59,"cloud":31,"feelslike_c":-3.8,"feelslike_f":25.2,"windchill_c":-3.8,"windchill_f":25.2,"heatindex_c":-0.8,"heatindex_f":30.6,"dewpoint_c":-6.8,"dewpoint_f":19.8,"will_it_rain":1,"chance_of_rain":"23","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.7,"gust_kph":23.7},
+{"time_epoch":1541851200,"time":"2018-11-10 07:00","temp_c":0.2,"temp_f":32.4,"is_day":1,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/day/116.png","code":1003},"wind_mph":6.5,"wind_kph":10.4,"wind_degree":175,"wind_dir":"WNW","pressure_mb":1010.1,"pressure_in":29.8,"precip_mm":0.1,"precip_in":0.0,"humidity":86,"cloud":57,"feelslike_c":-2.8,"feelslike_f":27.0,"windchill_c":-2.8,"windchill_f":27.0,"heatindex_c":0.2,"heatindex_f":32.4,"dewpoint_c":-5.8,"dewpoint_f":21.6,"will_it_rain":0,"chance_of_rain":"36","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.7,"gust_kph":15.6},
+{"time_epoch":1541854800,"time":"2018-11-10 08:00","temp_c":1.1,"temp_f":33.9,"is_day":1,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/day/116.png","code":1003},"wind_mph":5.4,"wind_kph":8.7,"wind_degree":175,"wind_dir":"WNW","pressure_mb":1010.0,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":49,"cloud":62,"feelslike_c":-1.9,"feelslike_f":28.5,"windchill_c":-1.9,"windchill_f":28.5,"heatindex_c":1.1,"heatindex_f":33.9,"dewpoint_c":-4.9,"dewpoint_f":23.1,"will_it_rain":0,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.1,"gust_kph":13.0},
+{"time_epoch":1541858400,"time":"2018-11-10 09:00","temp_c":1.5,"temp_f":34.8,"is_day":1,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/day/116.png","code":1003},"wind_mph":9.1,"wind_kph":14.7,"wind_degree":160,"wind_dir":"WNW","pressure_mb":1010.5,"pressure_in":29.8,"precip_mm":0.2,"precip_in":0.01,"humidity":61,"cloud":88,"feelslike_c":-1.5,"feelslike_f":29.4,"windchill_c":-1.5,"windchill_f":29.4,"heatindex_c":1.5,"heatindex_f":34.8,"dewpoint_c":-4.5,"dewpoint_f":24.0,"will_it_rain":0,"chance_of_rain":"44","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.7,"gust_kph":22.0},
+{"time_epoch":1541862000,"time":"2018-11-10 10:00","temp_c":3.1,"temp_f":37.6,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":8.6,"wind_kph":13.8,"wind_degree":138,"wind_dir":"WNW","pressure_mb":1009.9,"pressure_in":29.8,"precip_mm":0.6,"precip_in":0.02,"humidity":70,"cloud":89,"feelslike_c":0.1,"feelslike_f":32.2,"windchill_c":0.1,"windchill_f":32.2,"heatindex_c":3.1,"heatindex_f":37.6,"dewpoint_c":-2.9,"dewpoint_f":26.8,"will_it_rain":1,"chance_of_rain":"85","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.9,"gust_kph":20.7},
+{"time_epoch":1541865600,"time":"2018-11-10 11:00","temp_c":3.6,"temp_f":38.4,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":9.5,"wind_kph":15.3,"wind_degree":348,"wind_dir":"WNW","pressure_mb":1009.6,"pressure_in":29.8,"precip_mm":0.2,"precip_in":0.01,"humidity":68,"cloud":36,"feelslike_c":0.6,"feelslike_f":33.0,"windchill_c":0.6,"windchill_f":33.0,"heatindex_c":3.6,"heatindex_f":38.4,"dewpoint_c":-2.4,"dewpoint_f":27.6,"will_it_rain":0,"chance_of_rain":"49","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.3,"gust_kph":23.0},
+{"time_epoch":1541869200,"time":"2018-11-10 12:00","temp_c":5.2,"temp_f":41.4,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":7.1,"wind_kph":11.5,"wind_degree":312,"wind_dir":"WNW","pressure_mb":1010.9,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":47,"cloud":63,"feelslike_c":2.2,"feelslike_f":36.0,"windchill_c":2.2,"windchill_f":36.0,"heatindex_c":5.2,"heatindex_f":41.4,"dewpoint_c":-0.8,"dewpoint_f":30.6,"will_it_rain":0,"chance_of_rain":"7","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.7,"gust_kph":17.2},
+{"time_epoch":1541872800,"time":"2018-11-10 13:00","temp_c":5.2,"temp_f":41.3,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":6.8,"wind_kph":10.9,"wind_degree":254,"wind_dir":"WNW","pressure_mb":1010.5,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":45,"cloud":21,"feelslike_c":2.2,"feelslike_f":35.9,"windchill_c":2.2,"windchill_f":35.9,"heatindex_c":5.2,"heatindex_f":41.3,"dewpoint_c":-0.8,"dewpoint_f":30.5,"will_it_rain":0,"chance_of_rain":"57","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.2,"gust_kph":16.4},
+{"time_epoch":1541876400,"time":"2018-11-10 14:00","temp_c":5.8,"temp_f":42.4,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":6.7,"wind_kph":10.8,"wind_degree":281,"wind_dir":"WNW","pressure_mb":1009.3,"pressure_in":29.8,"precip_mm":0.0,"precip_in":0.0,"humidity":57,"cloud":90,"feelslike_c":2.8,"feelslike_f":37.0,"windchill_c":2.8,"windchill_f":37.0,"heatindex_c":5.8,"heatindex_f":42.4,"dewpoint_c":-0.2,"dewpoint_f":31.6,"will_it_rain":0,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.1,"gust_kph":16.2},
+{"time_epoch":1541880000,"time":"2018-11-10 15:00","temp_c":6.5,"temp_f":43.7,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":9.2,"wind_kph":14.8,"wind_degree":42,"wind_dir":"WNW","pressure_mb":1009.8,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":51,"cloud":19,"feelslike_c":3.5,"feelslike_f":38.3,"windchill_c":3.5,"windchill_f":38.3,"heatindex_c":6.5,"heatindex_f":43.7,"dewpoint_c":0.5,"dewpoint_f":32.9,"will_it_rain":0,"chance_of_rain":"29","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.8,"gust_kph":22.2},
+{"time_epoch":1541883600,"time":"2018-11-10 16:00","temp_c":6.0,"temp_f":42.8,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":5.0,"wind_kph":8.1,"wind_degree":144,"wind_dir":"WNW","pressure_mb":1010.7,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":40,"cloud":18,"feelslike_c":3.0,"feelslike_f":37.4,"windchill_c":3.0,"windchill_f":37.4,"heatindex_c":6.0,"heatindex_f":42.8,"dewpoint_c":0.0,"dewpoint_f":32.0,"will_it_rain":0,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":7.6,"gust_kph":12.1},
+{"time_epoch":1541887200,"time":"2018-11-10 17:00","temp_c":5.5,"temp_f":41.9,"is_day":0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/night/122.png","code":1009},"wind_mph":8.8,"wind_kph":14.1,"wind_degree":263,"wind_dir":"WNW","pressure_mb":1009.6,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":79,"cloud":83,"feelslike_c":2.5,"feelslike_f":36.5,"windchill_c":2.5,"windchill_f":36.5,"heatindex_c":5.5,"heatindex_f":41.9,"dewpoint_c":-0.5,"dewpoint_f":31.1,"will_it_rain":0,"chance_of_rain":"86","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.1,"gust_kph":21.1},
+{"time_epoch":1541890800,"time":"2018-11-10 18:00","temp_c":5.1,"temp_f":41.1,"is_day":0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/night/122.png","code":1009},"wind_mph":7.8,"wind_kph":12.6,"wind_degree":348,"wind_dir":"WNW","pressure_mb":1010.7,"pressure_in":29.8,"precip_mm":0.7,"precip_in":0.03,"humidity":75,"cloud":50,"feelslike_c":2.1,"feelslike_f":35.7,"windchill_c":2.1,"windchill_f":35.7,"heatindex_c":5.1,"heatindex_f":41.1,"dewpoint_c":-0.9,"dewpoint_f":30.3,"will_it_rain":1,"chance_of_rain":"50","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":11.7,"gust_kph":18.9},
+{"time_epoch":1541894400,"time":"2018-11-10 19:00","temp_c":3.9,"temp_f":39.0,"is_day":0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/night/122.png","code":1009},"wind_mph":5.6,"wind_kph":9.0,"wind_degree":34,"wind_dir":"WNW","pressure_mb":1010.3,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":53,"cloud":56,"feelslike_c":0.9,"feelslike_f":33.6,"windchill_c":0.9,"windchill_f":33.6,"heatindex_c":3.9,"heatindex_f":39.0,"dewpoint_c":-2.1,"dewpoint_f":28.2,"will_it_rain":0,"chance_of_rain":"20","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.4,"gust_kph":13.5},
+{"time_epoch":1541898000,"time":"2018-11-10 20:00","temp_c":2.6,"temp_f":36.8,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":8.7,"wind_kph":14.0,"wind_degree":274,"wind_dir":"WNW","pressure_mb":1009.2,"pressure_in":29.8,"precip_mm":0.2,"precip_in":0.01,"humidity":46,"cloud":46,"feelslike_c":-0.4,"feelslike_f":31.4,"windchill_c":-0.4,"windchill_f":31.4,"heatindex_c":2.6,"heatindex_f":36.8,"dewpoint_c":-3.4,"dewpoint_f":26.0,"will_it_rain":0,"chance_of_rain":"78","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.1,"gust_kph":21.0},
+{"time_epoch":1541901600,"time":"2018-11-10 21:00","temp_c":1.5,"temp_f":34.7,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":10.4,"wind_kph":16.7,"wind_degree":129,"wind_dir":"WNW","pressure_mb":1010.2,"pressure_in":29.8,"precip_mm":0,"precip_in":0.0,"humidity":62,"cloud":77,"feelslike_c":-1.5,"feelslike_f":29.3,"windchill_c":-1.5,"windchill_f":29.3,"heatindex_c":1.5,"heatindex_f":34.7,"dewpoint_c":-4.5,"dewpoint_f":23.9,"will_it_rain":0,"chance_of_rain":"46","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.6,"gust_kph":25.0},
+{"time_epoch":1541905200,"time":"2018-11-10 22:00","temp_c":0.9,"temp_f":33.7,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":5.7,"wind_kph":9.2,"wind_degree":245,"wind_dir":"WNW","pressure_mb":1010.0,"pressure_in":29.8,"precip_mm":0.8,"precip_in":0.03,"humidity":70,"cloud":39,"feelslike_c":-2.1,"feelslike_f":28.3,"windchill_c":-2.1,"windchill_f":28.3,"heatindex_c":0.9,"heatindex_f":33.7,"dewpoint_c":-5.1,"dewpoint_f":22.9,"will_it_rain":1,"chance_of_rain":"10","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.6,"gust_kph":13.8},
+{"time_epoch":1541908800,"time":"2018-11-10 23:00","temp_c":-0.4,"temp_f":31.4,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":9.6,"wind_kph":15.5,"wind_degree":354,"wind_dir":"WNW","pressure_mb":1010.5,"pressure_in":29.8,"precip_mm":0.1,"precip_in":0.0,"humidity":50,"cloud":66,"feelslike_c":-3.4,"feelslike_f":26.0,"windchill_c":-3.4,"windchill_f":26.0,"heatindex_c":-0.4,"heatindex_f":31.4,"dewpoint_c":-6.4,"dewpoint_f":20.6,"will_it_rain":0,"chance_of_rain":"2","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.4,"gust_kph":23.2}]},
+{"date":"2018-11-11","date_epoch":1541894400,"day":{"maxtemp_c":7.0,"maxtemp_f":44.6,"mintemp_c":-1.3,"mintemp_f":29.7,"avgtemp_c":2.9,"avgtemp_f":37.1,"maxwind_mph":18.1,"maxwind_kph":29.2,"totalprecip_mm":3.9,"totalprecip_in":0.15,"avgvis_km":17.0,"avgvis_miles":10.0,"avghumidity":61.0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"uv":1.6},"astro":{"sunrise":"06:36 AM","sunset":"04:41 PM","moonrise":"10:37 AM","moonset":"07:58 PM"},"hour":[
+{"time_epoch":1541912400,"time":"2018-11-11 00:00","temp_c":-0.1,"temp_f":31.8,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":10.9,"wind_kph":17.5,"wind_degree":13,"wind_dir":"WNW","pressure_mb":1011.7,"pressure_in":29.9,"precip_mm":0.4,"precip_in":0.02,"humidity":88,"cloud":67,"feelslike_c":-3.1,"feelslike_f":26.4,"windchill_c":-3.1,"windchill_f":26.4,"heatindex_c":-0.1,"heatindex_f":31.8,"dewpoint_c":-6.1,"dewpoint_f":21.0,"will_it_rain":1,"chance_of_rain":"38","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.3,"gust_kph":26.2},
+{"time_epoch":1541916000,"time":"2018-11-11 01:00","temp_c":0.0,"temp_f":32.0,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":10.3,"wind_kph":16.6,"wind_degree":187,"wind_dir":"WNW","pressure_mb":1012.4,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":50,"cloud":45,"feelslike_c":-3.0,"feelslike_f":26.6,"windchill_c":-3.0,"windchill_f":26.6,"heatindex_c":0.0,"heatindex_f":32.0,"dewpoint_c":-6.0,"dewpoint_f":21.2,"will_it_rain":0,"chance_of_rain":"28","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.5,"gust_kph":24.9},
+{"time_epoch":1541919600,"time":"2018-11-11 02:00","temp_c":-0.8,"temp_f":30.5,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":9.8,"wind_kph":15.8,"wind_degree":99,"wind_dir":"WNW","pressure_mb":1011.7,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":55,"cloud":51,"feelslike_c":-3.8,"feelslike_f":25.1,"windchill_c":-3.8,"windchill_f":25.1,"heatindex_c":-0.8,"heatindex_f":30.5,"dewpoint_c":-6.8,"dewpoint_f":19.7,"will_it_rain":0,"chance_of_rain":"29","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.7,"gust_kph":23.7},
+{"time_epoch":1541923200,"time":"2018-11-11 03:00","temp_c":-1.3,"temp_f":29.7,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":8.0,"wind_kph":12.9,"wind_degree":143,"wind_dir":"WNW","pressure_mb":1012.5,"pressure_in":29.9,"precip_mm":0.8,"precip_in":0.03,"humidity":70,"cloud":33,"feelslike_c":-4.3,"feelslike_f":24.3,"windchill_c":-4.3,"windchill_f":24.3,"heatindex_c":-1.3,"heatindex_f":29.7,"dewpoint_c":-7.3,"dewpoint_f":18.9,"will_it_rain":1,"chance_of_rain":"24","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.0,"gust_kph":19.4},
+{"time_epoch":1541926800,"time":"2018-11-11 04:00","temp_c":-0.7,"temp_f":30.8,"is_day":0,"condition":{"text":"Partly cloudy","icon":"//cdn.apixu.com/weather/64x64/night/116.png","code":1003},"wind_mph":10.9,"wind_kph":17.6,"wind_degree":178,"wind_dir":"WNW","pressure_mb":1011.9,"pressure_in":29.9,"precip_mm":0.7,"precip_in":0.03,"humidity":63,"cloud":10,"feelslike_c":-3.7,"feelslike_f":25.4,"windchill_c":-3.7,"windchill_f":25.4,"heatindex_c":-0.7,"heatindex_f":30.8,"dewpoint_c":-6.7,"dewpoint_f":20.0,"will_it_rain":1,"chance_of_rain":"28","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.4,"gust_kph":26.4},
+{"time_epoch":1541930400,"time":"2018-11-11 05:00","temp_c":-0.9,"temp_f":30.4,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":7.9,"wind_kph":12.7,"wind_degree":312,"wind_dir":"WNW","pressure_mb":1011.7,"pressure_in":29.9,"precip_mm":0.1,"precip_in":0.0,"humidity":40,"cloud":61,"feelslike_c":-3.9,"feelslike_f":25.0,"windchill_c":-3.9,"windchill_f":25.0,"heatindex_c":-0.9,"heatindex_f":30.4,"dewpoint_c":-6.9,"dewpoint_f":19.6,"will_it_rain":0,"chance_of_rain":"83","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":11.8,"gust_kph":19.0},
+{"time_epoch":1541934000,"time":"2018-11-11 06:00","temp_c":0.0,"temp_f":32.0,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":8.9,"wind_kph":14.4,"wind_degree":198,"wind_dir":"WNW","pressure_mb":1012.7,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":90,"cloud":91,"feelslike_c":-3.0,"feelslike_f":26.6,"windchill_c":-3.0,"windchill_f":26.6,"heatindex_c":0.0,"heatindex_f":32.0,"dewpoint_c":-6.0,"dewpoint_f":21.2,"will_it_rain":0,"chance_of_rain":"25","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.4,"gust_kph":21.6},
+{"time_epoch":1541937600,"time":"2018-11-11 07:00","temp_c":1.0,"temp_f":33.8,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":6.1,"wind_kph":9.8,"wind_degree":202,"wind_dir":"WNW","pressure_mb":1012.6,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":69,"cloud":51,"feelslike_c":-2.0,"feelslike_f":28.4,"windchill_c":-2.0,"windchill_f":28.4,"heatindex_c":1.0,"heatindex_f":33.8,"dewpoint_c":-5.0,"dewpoint_f":23.0,"will_it_rain":0,"chance_of_rain":"10","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.1,"gust_kph":14.7},
+{"time_epoch":1541941200,"time":"2018-11-11 08:00","temp_c":2.2,"temp_f":35.9,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":6.0,"wind_kph":9.7,"wind_degree":238,"wind_dir":"WNW","pressure_mb":1011.3,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":81,"cloud":18,"feelslike_c":-0.8,"feelslike_f":30.5,"windchill_c":-0.8,"windchill_f":30.5,"heatindex_c":2.2,"heatindex_f":35.9,"dewpoint_c":-3.8,"dewpoint_f":25.1,"will_it_rain":0,"chance_of_rain":"78","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.0,"gust_kph":14.5},
+{"time_epoch":1541944800,"time":"2018-11-11 09:00","temp_c":3.3,"temp_f":38.0,"is_day":1,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/day/119.png","code":1006},"wind_mph":11.1,"wind_kph":17.8,"wind_degree":280,"wind_dir":"WNW","pressure_mb":1012.3,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":75,"cloud":16,"feelslike_c":0.3,"feelslike_f":32.6,"windchill_c":0.3,"windchill_f":32.6,"heatindex_c":3.3,"heatindex_f":38.0,"dewpoint_c":-2.7,"dewpoint_f":27.2,"will_it_rain":0,"chance_of_rain":"2","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.6,"gust_kph":26.7},
+{"time_epoch":1541948400,"time":"2018-11-11 10:00","temp_c":3.5,"temp_f":38.4,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":11.0,"wind_kph":17.7,"wind_degree":71,"wind_dir":"WNW","pressure_mb":1012.3,"pressure_in":29.9,"precip_mm":0.1,"precip_in":0.0,"humidity":67,"cloud":24,"feelslike_c":0.5,"feelslike_f":33.0,"windchill_c":0.5,"windchill_f":33.0,"heatindex_c":3.5,"heatindex_f":38.4,"dewpoint_c":-2.5,"dewpoint_f":27.6,"will_it_rain":0,"chance_of_rain":"27","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.5,"gust_kph":26.5},
+{"time_epoch":1541952000,"time":"2018-11-11 11:00","temp_c":4.5,"temp_f":40.2,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":6.3,"wind_kph":10.1,"wind_degree":166,"wind_dir":"WNW","pressure_mb":1012.0,"pressure_in":29.9,"precip_mm":0.5,"precip_in":0.02,"humidity":56,"cloud":69,"feelslike_c":1.5,"feelslike_f":34.8,"windchill_c":1.5,"windchill_f":34.8,"heatindex_c":4.5,"heatindex_f":40.2,"dewpoint_c":-1.5,"dewpoint_f":29.4,"will_it_rain":1,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.4,"gust_kph":15.1},
+{"time_epoch":1541955600,"time":"2018-11-11 12:00","temp_c":6.2,"temp_f":43.1,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":5.3,"wind_kph":8.6,"wind_degree":339,"wind_dir":"WNW","pressure_mb":1012.5,"pressure_in":29.9,"precip_mm":0.7,"precip_in":0.03,"humidity":77,"cloud":66,"feelslike_c":3.2,"feelslike_f":37.7,"windchill_c":3.2,"windchill_f":37.7,"heatindex_c":6.2,"heatindex_f":43.1,"dewpoint_c":0.2,"dewpoint_f":32.3,"will_it_rain":1,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.0,"gust_kph":12.9},
+{"time_epoch":1541959200,"time":"2018-11-11 13:00","temp_c":6.8,"temp_f":44.2,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":10.4,"wind_kph":16.8,"wind_degree":261,"wind_dir":"WNW","pressure_mb":1011.3,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":41,"cloud":56,"feelslike_c":3.8,"feelslike_f":38.8,"windchill_c":3.8,"windchill_f":38.8,"heatindex_c":6.8,"heatindex_f":44.2,"dewpoint_c":0.8,"dewpoint_f":33.4,"will_it_rain":0,"chance_of_rain":"23","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.7,"gust_kph":25.2},
+{"time_epoch":1541962800,"time":"2018-11-11 14:00","temp_c":7.0,"temp_f":44.6,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":9.8,"wind_kph":15.8,"wind_degree":316,"wind_dir":"WNW","pressure_mb":1011.3,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":86,"cloud":15,"feelslike_c":4.0,"feelslike_f":39.2,"windchill_c":4.0,"windchill_f":39.2,"heatindex_c":7.0,"heatindex_f":44.6,"dewpoint_c":1.0,"dewpoint_f":33.8,"will_it_rain":0,"chance_of_rain":"71","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.7,"gust_kph":23.7},
+{"time_epoch":1541966400,"time":"2018-11-11 15:00","temp_c":6.6,"temp_f":43.8,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":9.2,"wind_kph":14.8,"wind_degree":54,"wind_dir":"WNW","pressure_mb":1012.1,"pressure_in":29.9,"precip_mm":0.1,"precip_in":0.0,"humidity":75,"cloud":7,"feelslike_c":3.6,"feelslike_f":38.4,"windchill_c":3.6,"windchill_f":38.4,"heatindex_c":6.6,"heatindex_f":43.8,"dewpoint_c":0.6,"dewpoint_f":33.0,"will_it_rain":0,"chance_of_rain":"31","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.8,"gust_kph":22.2},
+{"time_epoch":1541970000,"time":"2018-11-11 16:00","temp_c":6.6,"temp_f":43.8,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":5.2,"wind_kph":8.4,"wind_degree":14,"wind_dir":"WNW","pressure_mb":1011.2,"pressure_in":29.9,"precip_mm":0.0,"precip_in":0.0,"humidity":88,"cloud":8,"feelslike_c":3.6,"feelslike_f":38.4,"windchill_c":3.6,"windchill_f":38.4,"heatindex_c":6.6,"heatindex_f":43.8,"dewpoint_c":0.6,"dewpoint_f":33.0,"will_it_rain":0,"chance_of_rain":"56","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":7.8,"gust_kph":12.6},
+{"time_epoch":1541973600,"time":"2018-11-11 17:00","temp_c":6.3,"temp_f":43.3,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":11.0,"wind_kph":17.7,"wind_degree":141,"wind_dir":"WNW","pressure_mb":1012.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":68,"cloud":65,"feelslike_c":3.3,"feelslike_f":37.9,"windchill_c":3.3,"windchill_f":37.9,"heatindex_c":6.3,"heatindex_f":43.3,"dewpoint_c":0.3,"dewpoint_f":32.5,"will_it_rain":0,"chance_of_rain":"68","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.5,"gust_kph":26.5},
+{"time_epoch":1541977200,"time":"2018-11-11 18:00","temp_c":6.1,"temp_f":43.0,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":8.1,"wind_kph":13.1,"wind_degree":132,"wind_dir":"WNW","pressure_mb":1011.5,"pressure_in":29.9,"precip_mm":0.1,"precip_in":0.0,"humidity":75,"cloud":25,"feelslike_c":3.1,"feelslike_f":37.6,"windchill_c":3.1,"windchill_f":37.6,"heatindex_c":6.1,"heatindex_f":43.0,"dewpoint_c":0.1,"dewpoint_f":32.2,"will_it_rain":0,"chance_of_rain":"57","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.2,"gust_kph":19.6},
+{"time_epoch":1541980800,"time":"2018-11-11 19:00","temp_c":4.6,"temp_f":40.3,"is_day":0,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/night/176.png","code":1063},"wind_mph":5.7,"wind_kph":9.2,"wind_degree":123,"wind_dir":"WNW","pressure_mb":1011.9,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":67,"cloud":9,"feelslike_c":1.6,"feelslike_f":34.9,"windchill_c":1.6,"windchill_f":34.9,"heatindex_c":4.6,"heatindex_f":40.3,"dewpoint_c":-1.4,"dewpoint_f":29.5,"will_it_rain":0,"chance_of_rain":"27","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.6,"gust_kph":13.8},
+{"time_epoch":1541984400,"time":"2018-11-11 20:00","temp_c":4.2,"temp_f":39.6,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":9.8,"wind_kph":15.8,"wind_degree":329,"wind_dir":"WNW","pressure_mb":1012.8,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":82,"cloud":46,"feelslike_c":1.2,"feelslike_f":34.2,"windchill_c":1.2,"windchill_f":34.2,"heatindex_c":4.2,"heatindex_f":39.6,"dewpoint_c":-1.8,"dewpoint_f":28.8,"will_it_rain":0,"chance_of_rain":"18","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.7,"gust_kph":23.7},
+{"time_epoch":1541988000,"time":"2018-11-11 21:00","temp_c":2.8,"temp_f":37.0,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":5.8,"wind_kph":9.4,"wind_degree":48,"wind_dir":"WNW","pressure_mb":1011.9,"pressure_in":29.9,"precip_mm":0.4,"precip_in":0.02,"humidity":65,"cloud":62,"feelslike_c":-0.2,"feelslike_f":31.6,"windchill_c":-0.2,"windchill_f":31.6,"heatindex_c":2.8,"heatindex_f":37.0,"dewpoint_c":-3.2,"dewpoint_f":26.2,"will_it_rain":1,"chance_of_rain":"20","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.8,"gust_kph":14.1},
+{"time_epoch":1541991600,"time":"2018-11-11 22:00","temp_c":2.5,"temp_f":36.4,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":10.1,"wind_kph":16.3,"wind_degree":263,"wind_dir":"WNW","pressure_mb":1011.3,"pressure_in":29.9,"precip_mm":0.0,"precip_in":0.0,"humidity":65,"cloud":43,"feelslike_c":-0.5,"feelslike_f":31.0,"windchill_c":-0.5,"windchill_f":31.0,"heatindex_c":2.5,"heatindex_f":36.4,"dewpoint_c":-3.5,"dewpoint_f":25.6,"will_it_rain":0,"chance_of_rain":"53","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.2,"gust_kph":24.5},
+{"time_epoch":1541995200,"time":"2018-11-11 23:00","temp_c":0.7,"temp_f":33.3,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":7.0,"wind_kph":11.2,"wind_degree":283,"wind_dir":"WNW","pressure_mb":1012.4,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":69,"cloud":56,"feelslike_c":-2.3,"feelslike_f":27.9,"windchill_c":-2.3,"windchill_f":27.9,"heatindex_c":0.7,"heatindex_f":33.3,"dewpoint_c":-5.3,"dewpoint_f":22.5,"will_it_rain":0,"chance_of_rain":"90","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.4,"gust_kph":16.8}]},
+{"date":"2018-11-12","date_epoch":1541980800,"day":{"maxtemp_c":8.1,"maxtemp_f":46.6,"mintemp_c":-0.1,"mintemp_f":31.8,"avgtemp_c":4.0,"avgtemp_f":39.2,"maxwind_mph":18.1,"maxwind_kph":29.2,"totalprecip_mm":3.8,"totalprecip_in":0.15,"avgvis_km":17.0,"avgvis_miles":10.0,"avghumidity":61.0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/day/296.png","code":1183},"uv":1.6},"astro":{"sunrise":"06:38 AM","sunset":"04:40 PM","moonrise":"11:25 AM","moonset":"08:57 PM"},"hour":[
+{"time_epoch":1541998800,"time":"2018-11-12 00:00","temp_c":0.7,"temp_f":33.2,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":7.0,"wind_kph":11.3,"wind_degree":32,"wind_dir":"WNW","pressure_mb":1014.2,"pressure_in":29.9,"precip_mm":0.1,"precip_in":0.0,"humidity":47,"cloud":100,"feelslike_c":-2.3,"feelslike_f":27.8,"windchill_c":-2.3,"windchill_f":27.8,"heatindex_c":0.7,"heatindex_f":33.2,"dewpoint_c":-5.3,"dewpoint_f":22.4,"will_it_rain":0,"chance_of_rain":"29","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.5,"gust_kph":17.0},
+{"time_epoch":1542002400,"time":"2018-11-12 01:00","temp_c":1.0,"temp_f":33.8,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":5.6,"wind_kph":9.0,"wind_degree":92,"wind_dir":"WNW","pressure_mb":1013.5,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":57,"cloud":96,"feelslike_c":-2.0,"feelslike_f":28.4,"windchill_c":-2.0,"windchill_f":28.4,"heatindex_c":1.0,"heatindex_f":33.8,"dewpoint_c":-5.0,"dewpoint_f":23.0,"will_it_rain":0,"chance_of_rain":"16","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.4,"gust_kph":13.5},
+{"time_epoch":1542006000,"time":"2018-11-12 02:00","temp_c":0.5,"temp_f":32.8,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":10.3,"wind_kph":16.5,"wind_degree":207,"wind_dir":"WNW","pressure_mb":1014.4,"pressure_in":30.0,"precip_mm":0.7,"precip_in":0.03,"humidity":49,"cloud":68,"feelslike_c":-2.5,"feelslike_f":27.4,"windchill_c":-2.5,"windchill_f":27.4,"heatindex_c":0.5,"heatindex_f":32.8,"dewpoint_c":-5.5,"dewpoint_f":22.0,"will_it_rain":1,"chance_of_rain":"65","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":15.4,"gust_kph":24.8},
+{"time_epoch":1542009600,"time":"2018-11-12 03:00","temp_c":0.1,"temp_f":32.1,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":9.3,"wind_kph":15.0,"wind_degree":352,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":51,"cloud":54,"feelslike_c":-2.9,"feelslike_f":26.7,"windchill_c":-2.9,"windchill_f":26.7,"heatindex_c":0.1,"heatindex_f":32.1,"dewpoint_c":-5.9,"dewpoint_f":21.3,"will_it_rain":0,"chance_of_rain":"9","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.0,"gust_kph":22.5},
+{"time_epoch":1542013200,"time":"2018-11-12 04:00","temp_c":-0.1,"temp_f":31.8,"is_day":0,"condition":{"text":"Cloudy","icon":"//cdn.apixu.com/weather/64x64/night/119.png","code":1006},"wind_mph":5.1,"wind_kph":8.2,"wind_degree":311,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":54,"cloud":8,"feelslike_c":-3.1,"feelslike_f":26.4,"windchill_c":-3.1,"windchill_f":26.4,"heatindex_c":-0.1,"heatindex_f":31.8,"dewpoint_c":-6.1,"dewpoint_f":21.0,"will_it_rain":0,"chance_of_rain":"33","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":7.6,"gust_kph":12.3},
+{"time_epoch":1542016800,"time":"2018-11-12 05:00","temp_c":0.9,"temp_f":33.6,"is_day":0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/night/122.png","code":1009},"wind_mph":7.8,"wind_kph":12.5,"wind_degree":137,"wind_dir":"WNW","pressure_mb":1013.7,"pressure_in":29.9,"precip_mm":0.2,"precip_in":0.01,"humidity":79,"cloud":16,"feelslike_c":-2.1,"feelslike_f":28.2,"windchill_c":-2.1,"windchill_f":28.2,"heatindex_c":0.9,"heatindex_f":33.6,"dewpoint_c":-5.1,"dewpoint_f":22.8,"will_it_rain":0,"chance_of_rain":"5","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":11.7,"gust_kph":18.8},
+{"time_epoch":1542020400,"time":"2018-11-12 06:00","temp_c":1.2,"temp_f":34.2,"is_day":0,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/night/122.png","code":1009},"wind_mph":6.5,"wind_kph":10.4,"wind_degree":25,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":51,"cloud":25,"feelslike_c":-1.8,"feelslike_f":28.8,"windchill_c":-1.8,"windchill_f":28.8,"heatindex_c":1.2,"heatindex_f":34.2,"dewpoint_c":-4.8,"dewpoint_f":23.4,"will_it_rain":0,"chance_of_rain":"39","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.7,"gust_kph":15.6},
+{"time_epoch":1542024000,"time":"2018-11-12 07:00","temp_c":2.1,"temp_f":35.8,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":8.3,"wind_kph":13.3,"wind_degree":344,"wind_dir":"WNW","pressure_mb":1013.4,"pressure_in":29.9,"precip_mm":0.0,"precip_in":0.0,"humidity":51,"cloud":34,"feelslike_c":-0.9,"feelslike_f":30.4,"windchill_c":-0.9,"windchill_f":30.4,"heatindex_c":2.1,"heatindex_f":35.8,"dewpoint_c":-3.9,"dewpoint_f":25.0,"will_it_rain":0,"chance_of_rain":"44","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.4,"gust_kph":20.0},
+{"time_epoch":1542027600,"time":"2018-11-12 08:00","temp_c":3.3,"temp_f":37.9,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":11.1,"wind_kph":17.9,"wind_degree":258,"wind_dir":"WNW","pressure_mb":1013.1,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":75,"cloud":24,"feelslike_c":0.3,"feelslike_f":32.5,"windchill_c":0.3,"windchill_f":32.5,"heatindex_c":3.3,"heatindex_f":37.9,"dewpoint_c":-2.7,"dewpoint_f":27.1,"will_it_rain":0,"chance_of_rain":"65","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.7,"gust_kph":26.8},
+{"time_epoch":1542031200,"time":"2018-11-12 09:00","temp_c":4.0,"temp_f":39.2,"is_day":1,"condition":{"text":"Overcast","icon":"//cdn.apixu.com/weather/64x64/day/122.png","code":1009},"wind_mph":10.8,"wind_kph":17.3,"wind_degree":221,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0.5,"precip_in":0.02,"humidity":82,"cloud":63,"feelslike_c":1.0,"feelslike_f":33.8,"windchill_c":1.0,"windchill_f":33.8,"heatindex_c":4.0,"heatindex_f":39.2,"dewpoint_c":-2.0,"dewpoint_f":28.4,"will_it_rain":1,"chance_of_rain":"69","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":16.1,"gust_kph":26.0},
+{"time_epoch":1542034800,"time":"2018-11-12 10:00","temp_c":5.4,"temp_f":41.7,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":7.4,"wind_kph":11.9,"wind_degree":117,"wind_dir":"WNW","pressure_mb":1014.0,"pressure_in":29.9,"precip_mm":0.4,"precip_in":0.02,"humidity":61,"cloud":25,"feelslike_c":2.4,"feelslike_f":36.3,"windchill_c":2.4,"windchill_f":36.3,"heatindex_c":5.4,"heatindex_f":41.7,"dewpoint_c":-0.6,"dewpoint_f":30.9,"will_it_rain":1,"chance_of_rain":"90","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":11.1,"gust_kph":17.9},
+{"time_epoch":1542038400,"time":"2018-11-12 11:00","temp_c":6.2,"temp_f":43.2,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":5.8,"wind_kph":9.4,"wind_degree":66,"wind_dir":"WNW","pressure_mb":1015.0,"pressure_in":30.0,"precip_mm":0.8,"precip_in":0.03,"humidity":40,"cloud":9,"feelslike_c":3.2,"feelslike_f":37.8,"windchill_c":3.2,"windchill_f":37.8,"heatindex_c":6.2,"heatindex_f":43.2,"dewpoint_c":0.2,"dewpoint_f":32.4,"will_it_rain":1,"chance_of_rain":"80","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.8,"gust_kph":14.1},
+{"time_epoch":1542042000,"time":"2018-11-12 12:00","temp_c":7.1,"temp_f":44.7,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":6.6,"wind_kph":10.6,"wind_degree":195,"wind_dir":"WNW","pressure_mb":1013.3,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":72,"cloud":85,"feelslike_c":4.1,"feelslike_f":39.3,"windchill_c":4.1,"windchill_f":39.3,"heatindex_c":7.1,"heatindex_f":44.7,"dewpoint_c":1.1,"dewpoint_f":33.9,"will_it_rain":0,"chance_of_rain":"36","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":9.9,"gust_kph":15.9},
+{"time_epoch":1542045600,"time":"2018-11-12 13:00","temp_c":7.6,"temp_f":45.6,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":9.3,"wind_kph":14.9,"wind_degree":137,"wind_dir":"WNW","pressure_mb":1013.1,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":68,"cloud":0,"feelslike_c":4.6,"feelslike_f":40.2,"windchill_c":4.6,"windchill_f":40.2,"heatindex_c":7.6,"heatindex_f":45.6,"dewpoint_c":1.6,"dewpoint_f":34.8,"will_it_rain":0,"chance_of_rain":"33","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.9,"gust_kph":22.4},
+{"time_epoch":1542049200,"time":"2018-11-12 14:00","temp_c":7.7,"temp_f":45.9,"is_day":1,"condition":{"text":"Patchy rain possible","icon":"//cdn.apixu.com/weather/64x64/day/176.png","code":1063},"wind_mph":7.0,"wind_kph":11.3,"wind_degree":17,"wind_dir":"WNW","pressure_mb":1015.0,"pressure_in":30.0,"precip_mm":0,"precip_in":0.0,"humidity":59,"cloud":27,"feelslike_c":4.7,"feelslike_f":40.5,"windchill_c":4.7,"windchill_f":40.5,"heatindex_c":7.7,"heatindex_f":45.9,"dewpoint_c":1.7,"dewpoint_f":35.1,"will_it_rain":0,"chance_of_rain":"45","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.5,"gust_kph":17.0},
+{"time_epoch":1542052800,"time":"2018-11-12 15:00","temp_c":7.7,"temp_f":45.8,"is_day":1,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/day/296.png","code":1183},"wind_mph":7.1,"wind_kph":11.4,"wind_degree":335,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":52,"cloud":31,"feelslike_c":4.7,"feelslike_f":40.4,"windchill_c":4.7,"windchill_f":40.4,"heatindex_c":7.7,"heatindex_f":45.8,"dewpoint_c":1.7,"dewpoint_f":35.0,"will_it_rain":0,"chance_of_rain":"64","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.6,"gust_kph":17.1},
+{"time_epoch":1542056400,"time":"2018-11-12 16:00","temp_c":8.1,"temp_f":46.7,"is_day":1,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/day/296.png","code":1183},"wind_mph":5.5,"wind_kph":8.9,"wind_degree":300,"wind_dir":"WNW","pressure_mb":1014.6,"pressure_in":30.0,"precip_mm":0,"precip_in":0.0,"humidity":42,"cloud":50,"feelslike_c":5.1,"feelslike_f":41.3,"windchill_c":5.1,"windchill_f":41.3,"heatindex_c":8.1,"heatindex_f":46.7,"dewpoint_c":2.1,"dewpoint_f":35.9,"will_it_rain":0,"chance_of_rain":"2","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":8.3,"gust_kph":13.4},
+{"time_epoch":1542060000,"time":"2018-11-12 17:00","temp_c":7.3,"temp_f":45.1,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":8.9,"wind_kph":14.3,"wind_degree":79,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0.7,"precip_in":0.03,"humidity":82,"cloud":91,"feelslike_c":4.3,"feelslike_f":39.7,"windchill_c":4.3,"windchill_f":39.7,"heatindex_c":7.3,"heatindex_f":45.1,"dewpoint_c":1.3,"dewpoint_f":34.3,"will_it_rain":1,"chance_of_rain":"76","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.3,"gust_kph":21.5},
+{"time_epoch":1542063600,"time":"2018-11-12 18:00","temp_c":6.7,"temp_f":44.1,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":7.0,"wind_kph":11.3,"wind_degree":316,"wind_dir":"WNW","pressure_mb":1015.0,"pressure_in":30.0,"precip_mm":0,"precip_in":0.0,"humidity":81,"cloud":18,"feelslike_c":3.7,"feelslike_f":38.7,"windchill_c":3.7,"windchill_f":38.7,"heatindex_c":6.7,"heatindex_f":44.1,"dewpoint_c":0.7,"dewpoint_f":33.3,"will_it_rain":0,"chance_of_rain":"5","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":10.5,"gust_kph":17.0},
+{"time_epoch":1542067200,"time":"2018-11-12 19:00","temp_c":6.3,"temp_f":43.4,"is_day":0,"condition":{"text":"Light rain","icon":"//cdn.apixu.com/weather/64x64/night/296.png","code":1183},"wind_mph":9.4,"wind_kph":15.2,"wind_degree":358,"wind_dir":"WNW","pressure_mb":1014.0,"pressure_in":29.9,"precip_mm":0.0,"precip_in":0.0,"humidity":72,"cloud":17,"feelslike_c":3.3,"feelslike_f":38.0,"windchill_c":3.3,"windchill_f":38.0,"heatindex_c":6.3,"heatindex_f":43.4,"dewpoint_c":0.3,"dewpoint_f":32.6,"will_it_rain":0,"chance_of_rain":"67","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.2,"gust_kph":22.8},
+{"time_epoch":1542070800,"time":"2018-11-12 20:00","temp_c":5.3,"temp_f":41.5,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":8.5,"wind_kph":13.7,"wind_degree":351,"wind_dir":"WNW","pressure_mb":1014.6,"pressure_in":30.0,"precip_mm":0,"precip_in":0.0,"humidity":77,"cloud":91,"feelslike_c":2.3,"feelslike_f":36.1,"windchill_c":2.3,"windchill_f":36.1,"heatindex_c":5.3,"heatindex_f":41.5,"dewpoint_c":-0.7,"dewpoint_f":30.7,"will_it_rain":0,"chance_of_rain":"87","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.8,"gust_kph":20.5},
+{"time_epoch":1542074400,"time":"2018-11-12 21:00","temp_c":4.5,"temp_f":40.0,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":8.9,"wind_kph":14.4,"wind_degree":326,"wind_dir":"WNW","pressure_mb":1013.2,"pressure_in":29.9,"precip_mm":0,"precip_in":0.0,"humidity":63,"cloud":13,"feelslike_c":1.5,"feelslike_f":34.6,"windchill_c":1.5,"windchill_f":34.6,"heatindex_c":4.5,"heatindex_f":40.0,"dewpoint_c":-1.5,"dewpoint_f":29.2,"will_it_rain":0,"chance_of_rain":"48","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":13.4,"gust_kph":21.6},
+{"time_epoch":1542078000,"time":"2018-11-12 22:00","temp_c":3.3,"temp_f":37.9,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":8.5,"wind_kph":13.6,"wind_degree":348,"wind_dir":"WNW","pressure_mb":1014.3,"pressure_in":30.0,"precip_mm":0.3,"precip_in":0.01,"humidity":55,"cloud":62,"feelslike_c":0.3,"feelslike_f":32.5,"windchill_c":0.3,"windchill_f":32.5,"heatindex_c":3.3,"heatindex_f":37.9,"dewpoint_c":-2.7,"dewpoint_f":27.1,"will_it_rain":0,"chance_of_rain":"33","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":12.7,"gust_kph":20.4},
+{"time_epoch":1542081600,"time":"2018-11-12 23:00","temp_c":1.5,"temp_f":34.7,"is_day":0,"condition":{"text":"Sunny","icon":"//cdn.apixu.com/weather/64x64/night/113.png","code":1000},"wind_mph":9.9,"wind_kph":16.0,"wind_degree":274,"wind_dir":"WNW","pressure_mb":1014.5,"pressure_in":30.0,"precip_mm":0.1,"precip_in":0.0,"humidity":45,"cloud":84,"feelslike_c":-1.5,"feelslike_f":29.3,"windchill_c":-1.5,"windchill_f":29.3,"heatindex_c":1.5,"heatindex_f":34.7,"dewpoint_c":-4.5,"dewpoint_f":23.9,"will_it_rain":0,"chance_of_rain":"67","will_it_snow":0,"chance_of_snow":"0","vis_km":10.0,"vis_miles":6.0,"gust_mph":14.9,"gust_kph":24.0}]}]}})=====";
+
+// Golden values that the parser must extract from forecast_json, metric then imperial
+// Index 0 is metric, index 1 is imperial
+
+#define GOLDEN_DAYS 3
+
+const float    golden_temp[2]     = { 4.4, 39.9 };
+const float    golden_wind[2]     = { 22.0, 13.6 };
+const float    golden_pressure[2] = { 1012.0, 30.4 };
+const float    golden_precip[2]   = { 0.1, 0.0 };
+
+const uint32_t golden_date_epoch[GOLDEN_DAYS]     = { 1541808000, 1541894400, 1541980800 };
+const float    golden_maxtemp[2][GOLDEN_DAYS]     = { { 6.5, 7.0, 8.1 }, { 43.7, 44.6, 46.6 } };
+const float    golden_mintemp[2][GOLDEN_DAYS]     = { { -1.9, -1.3, -0.1 }, { 28.6, 29.7, 31.8 } };
+const float    golden_totalprecip[2][GOLDEN_DAYS] = { { 4.4, 3.9, 3.8 }, { 0.17, 0.15, 0.15 } };
+const char*    golden_text[GOLDEN_DAYS]           = { "Partly cloudy", "Overcast", "Light rain" };
+const char*    golden_sunrise[GOLDEN_DAYS]        = { "06:35 AM", "06:36 AM", "06:38 AM" };
+const char*    golden_moonset[GOLDEN_DAYS]        = { "07:02 PM", "07:58 PM", "08:57 PM" };
+
+// Hourly window from the hour in progress at localtime_epoch, first and last hour
+#define GOLDEN_HOURS 24
+
+const uint32_t golden_hour_epoch[2]  = { 1541862000, 1541944800 };
+const float    golden_hour_temp[2]   = { 3.1, 3.3 };
+const uint8_t  golden_hour_wind      = 14; // kph rounded, first hour
+const uint8_t  golden_hour_rain      = 85; // chance_of_rain %, first hour
@@ -15,6 +15,7 @@
 #include <JSON_Decoder.h> // Load library from: https://github.com/Bodmer/JSON_Decoder
 
 #include <ApixuWeather.h> // Load library from: https://github.com/Bodmer/ApixuWeather
+#include <APW_Scheduler.h>
 
 #include <Time.h> // Standard Arduino Time library: https://github.com/PaulStoffregen/Time
 
@@ -51,6 +52,8 @@ String loc =  "New%20York"; // No spaces allowed, use %20 for spaces
 
 Apixu_Weather apw; // Weather forecast library instance
 
+APW_Scheduler schedule; // Fetches only when the server will have new values
+
 /***************************************************************************************
 **                          setup
 ***************************************************************************************/
@@ -75,33 +78,40 @@ void setup() {
 ***************************************************************************************/
 void loop() {
 
+  // Create the structures that hold the retrieved weather
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  Serial.print("\nRequesting weather information from Apixu.net... ");
+
+  // One request collects both metric and imperial values
   apw.setMetric(true); // mm rain, deg.C, millibars (hPa) pressure, kph
-  printCurrentWeather();
+  if (apw.getForecast(current, forecast, api_key, loc))
+  {
+    schedule.fetched(current);
+    printCurrentWeather(current, forecast);
 
-  delay(1000);
+    apw.setMetric(false); // inches rain, deg.F, inches pressure, mph
+    apw.applyUnits(current, forecast); // No new request needed
+    printCurrentWeather(current, forecast);
+  }
+  else schedule.failed();
 
-  apw.setMetric(false); // inches rain, deg.F, inches pressure, mph
-  printCurrentWeather();
+  // Delete to free up space and prevent fragmentation as strings change in length
+  delete current;
+  delete forecast;
 
-  delay(5UL * 60UL * 1000UL); // Every 5 minutes
+  // Wait until the server will have new values, or to retry after a failure
+  Serial.print("Next request in "); Serial.print(schedule.secondsUntil()); Serial.println("s");
+  delay(schedule.secondsUntil() * 1000UL);
 
 }
 
 /***************************************************************************************
 **                          Send weather info to serial port
 ***************************************************************************************/
-void printCurrentWeather()
+void printCurrentWeather(APW_current *current, APW_forecast *forecast)
 {
-  // Create the structures that hold the retrieved weather
-  APW_current  *current  = new APW_current;
-  APW_forecast *forecast = new APW_forecast;
-
-  time_t time;
-
-  Serial.print("\nRequesting weather information from Apixu.net... ");
-
-  apw.getForecast(current, forecast, api_key, loc);
-
   Serial.println("Weather from Apixu\n");
 
 
@@ -112,7 +122,7 @@ void printCurrentWeather()
   Serial.print("country            : "); Serial.println(current->country);
   Serial.print("localtime_epoch    : "); Serial.print(strTime(current->localtime_epoch));
   Serial.print("last_updated_epoch : "); Serial.print(strTime(current->last_updated_epoch));
-  Serial.print("text               : "); Serial.println(current->text);
+  Serial.print("text               : "); Serial.println(apw.conditionText(current->condition, current->is_day));
   Serial.print("icon code          : "); Serial.println(apw.iconName(current->code));
   Serial.print("precip             : "); Serial.println(current->precip);
   Serial.print("temp               : "); Serial.println(current->temp);
@@ -134,17 +144,13 @@ void printCurrentWeather()
     Serial.print("maxtemp       : "); Serial.println(forecast->maxtemp[i]);
     Serial.print("mintemp       : "); Serial.println(forecast->mintemp[i]);
     Serial.print("totalprecip   : "); Serial.println(forecast->totalprecip[i]);
-    Serial.print("text          : "); Serial.println(forecast->text[i]);
+    Serial.print("text          : "); Serial.println(apw.conditionText(forecast->condition[i]));
     Serial.print("code          : "); Serial.println(apw.iconName(forecast->code[i]));
     Serial.print("sunrise       : "); Serial.println(forecast->sunrise[i]);
     Serial.print("sunset        : "); Serial.println(forecast->sunset[i]);
 
     Serial.println();
   }
-
-  // Delete to free up space and prevent fragmentation as strings change in length
-  delete current;
-  delete forecast;
 }
 
 /***************************************************************************************
@@ -0,0 +1,36 @@
+// Add the first day of recorded responses to an APW_History store on the host
+
+//   apw_ingest <store folder> <prefix> <threads> <response file>...
+
+// e.g. apw_ingest history /ny 8 archive/*.json adds the days to history/ny.d etc.
+// The files may be in any order, the days are added in date order.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <JSON_Decoder.h>
+#include <ApixuWeather.h>
+
+#include "ingest.h"
+
+int main(int argc, char *argv[])
+{
+  if (argc < 5)
+  {
+    fprintf(stderr, "usage: %s <store folder> <prefix> <threads> <response file>...\n", argv[0]);
+    return 2;
+  }
+
+  fs::FS store(argv[1]);
+  APW_History history(store, argv[2]);
+  std::vector<std::string> paths(argv + 4, argv + argc);
+
+  ingest_result r = Ingest::run(history, paths, atoi(argv[3]));
+
+  printf("files %u, added %u, skipped %u, failed %u, stolen %u\n",
+         r.files, r.added, r.skipped, r.failed, r.stolen);
+  printf("parse ms %u, add ms %u, %u days stored\n", r.parse_us / 1000, r.add_us / 1000, history.count());
+
+  return r.failed ? 1 : 0;
+}
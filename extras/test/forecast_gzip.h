@@ -0,0 +1,383 @@
+// The recorded forecast.json response of forecast_sample.h as sent by a server with
+// Content-Encoding: gzip, HTTP header included. Generated from forecast_json with
+// gzip level 6, the 32768 byte window is needed to decode it.
+
+#define FORECAST_GZIP_LENGTH 5999
+
+const uint8_t forecast_gzip[FORECAST_GZIP_LENGTH] PROGMEM = {
+  0x48, 0x54, 0x54, 0x50, 0x2F, 0x31, 0x2E, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4F, 0x4B, 0x0D,
+  0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x61,
+  0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x0D,
+  0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x45, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E,
+  0x67, 0x3A, 0x20, 0x67, 0x7A, 0x69, 0x70, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+  0x2D, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x20, 0x35, 0x39, 0x30, 0x32, 0x0D, 0x0A, 0x0D,
+  0x0A, 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD5, 0x5D, 0x59, 0x6F, 0x1B,
+  0x49, 0xD2, 0x7C, 0xDF, 0x5F, 0x21, 0xF0, 0xD9, 0xA4, 0x2B, 0xEB, 0x2E, 0xBD, 0x0D, 0xF6, 0x75,
+  0x2F, 0x60, 0xB0, 0x58, 0x7C, 0xF8, 0xB0, 0x10, 0xB4, 0x12, 0x6D, 0x13, 0xD6, 0x05, 0x1D, 0x63,
+  0x7B, 0x07, 0xFE, 0xEF, 0xDB, 0x87, 0xD8, 0xDD, 0x95, 0x51, 0xCD, 0x4E, 0x9A, 0x6C, 0xD1, 0x03,
+  0xBF, 0x98, 0xED, 0x12, 0x2D, 0x76, 0x07, 0x33, 0x2B, 0x33, 0x23, 0xA2, 0x7E, 0x5F, 0xDC, 0xDC,
+  0x5F, 0x5D, 0x3E, 0x6F, 0xEE, 0xEF, 0x16, 0xE7, 0xBF, 0x2F, 0xEE, 0x2E, 0x6F, 0xD7, 0x8B, 0xF3,
+  0xC5, 0xDF, 0xD6, 0x5F, 0xCE, 0xFE, 0xEF, 0xFE, 0xF1, 0xF3, 0xE2, 0xDD, 0xE2, 0x71, 0xFD, 0xB1,
+  0xF9, 0xB7, 0xE1, 0xB5, 0xAB, 0xFB, 0x97, 0xBB, 0xE7, 0xC7, 0x6F, 0xD5, 0xC5, 0x7F, 0xDE, 0x6D,
+  0x9E, 0xD7, 0xD7, 0x67, 0xBF, 0x3E, 0x5F, 0x3E, 0xAF, 0x9F, 0xCE, 0xEE, 0x3F, 0x9C, 0xFD, 0x72,
+  0xBB, 0x7E, 0xDC, 0x5C, 0x5D, 0x56, 0x8B, 0x6E, 0x2E, 0x9F, 0x17, 0xE7, 0x56, 0xAD, 0x02, 0x55,
+  0x7F, 0xAF, 0xDF, 0x61, 0x19, 0xEC, 0x4A, 0x55, 0x2F, 0x9E, 0xFF, 0x7B, 0xB1, 0xB9, 0xAE, 0x7E,
+  0xF6, 0x75, 0xE9, 0xFB, 0xEA, 0x8D, 0x2F, 0x5E, 0xDF, 0xB8, 0xFE, 0x55, 0x6E, 0x9E, 0x37, 0xB7,
+  0xEB, 0x8B, 0xF5, 0xC3, 0xFD, 0xD5, 0xA7, 0xC5, 0x39, 0x39, 0x4B, 0xD1, 0x3B, 0x65, 0xF4, 0xE0,
+  0x1F, 0xAB, 0x9F, 0xD5, 0x8A, 0xE2, 0x92, 0x68, 0x49, 0xEA, 0x8C, 0xD4, 0xB9, 0x53, 0x8B, 0xEF,
+  0xEF, 0xFE, 0xB4, 0xB8, 0x7A, 0x79, 0x7C, 0x5C, 0xDF, 0x3D, 0xD7, 0x9F, 0xE3, 0xE6, 0xF2, 0xE9,
+  0xF9, 0xE2, 0xE5, 0xE1, 0xBA, 0xFA, 0xB5, 0xAE, 0xF3, 0xF7, 0xB2, 0x81, 0xEA, 0xF7, 0x1A, 0xFC,
+  0x3B, 0xBC, 0x9D, 0x75, 0xD5, 0xAF, 0xF2, 0xBC, 0xBE, 0x7D, 0xB8, 0xB8, 0xAA, 0x3E, 0xC1, 0xCA,
+  0xBE, 0xBE, 0xF8, 0xB0, 0x38, 0x37, 0x69, 0x95, 0xDE, 0x2D, 0x36, 0x4F, 0x17, 0xD7, 0x97, 0xD5,
+  0xA7, 0xA7, 0xFA, 0x4E, 0xDC, 0x5D, 0x6F, 0xB6, 0x37, 0xEF, 0x79, 0xFD, 0xB5, 0xFA, 0xCF, 0x17,
+  0xFF, 0xB8, 0x7C, 0x7C, 0xBE, 0xF9, 0x76, 0x76, 0x75, 0x73, 0xFF, 0x72, 0xFD, 0xAD, 0x7A, 0xA7,
+  0xCD, 0x55, 0x73, 0xFF, 0xDE, 0xBF, 0xBF, 0xBA, 0xBE, 0x5B, 0x5D, 0x3E, 0x6C, 0xBE, 0xBE, 0xAC,
+  0xAE, 0xEE, 0x6F, 0xDF, 0x7F, 0x59, 0x5F, 0x3E, 0x7F, 0x5A, 0x3F, 0xBE, 0xF7, 0xF6, 0xAB, 0xB7,
+  0xEF, 0xAB, 0x37, 0x7C, 0x4F, 0xE4, 0x57, 0x0F, 0x77, 0x1F, 0x9B, 0x1B, 0x7C, 0x5D, 0x7D, 0x4A,
+  0x52, 0xCA, 0x7C, 0x7F, 0xB7, 0xF8, 0xB2, 0xB9, 0xBB, 0xBE, 0xB8, 0x7D, 0xA8, 0x3F, 0x81, 0x59,
+  0xF9, 0xD7, 0xD7, 0x9F, 0xEB, 0xD7, 0x5A, 0xAF, 0xD4, 0xEB, 0xEB, 0xEB, 0xF5, 0xC7, 0xC7, 0x75,
+  0xF5, 0x33, 0x3A, 0x75, 0x57, 0x36, 0x8F, 0xD5, 0xFF, 0xFA, 0xAF, 0xBF, 0xFD, 0xAB, 0x7A, 0xBF,
+  0x87, 0xC7, 0xF5, 0xD3, 0xD3, 0xCB, 0xE3, 0xFA, 0xE2, 0xF6, 0x3F, 0xF5, 0xDB, 0x52, 0xF3, 0x73,
+  0xDD, 0xC5, 0x4D, 0xF5, 0xEB, 0x19, 0x55, 0x7F, 0xCE, 0xEA, 0xD2, 0xD5, 0xE6, 0xE1, 0xE2, 0xF6,
+  0x76, 0x71, 0xAE, 0x56, 0xD4, 0xBD, 0xAE, 0x17, 0xA8, 0xFA, 0x47, 0x3E, 0xBD, 0xDC, 0x6E, 0xAA,
+  0xCF, 0x5B, 0x7D, 0x76, 0x67, 0xAA, 0xDF, 0xB2, 0xFE, 0x84, 0xD5, 0x5F, 0xAB, 0x7F, 0xF8, 0xB0,
+  0x5E, 0xDF, 0x3C, 0xDD, 0x6C, 0x3E, 0xAF, 0xEB, 0x5B, 0xB6, 0x54, 0x2B, 0x33, 0xBC, 0x54, 0xDF,
+  0x38, 0x5A, 0xB9, 0x77, 0x8B, 0xDF, 0xAA, 0x3B, 0xF7, 0xB9, 0x7A, 0xEF, 0xEA, 0x73, 0xAA, 0xF6,
+  0xD5, 0xED, 0xE6, 0x66, 0xFD, 0xB4, 0x38, 0x4F, 0xF5, 0xEB, 0x97, 0xDF, 0xAA, 0x75, 0x2B, 0x55,
+  0x3F, 0xC9, 0x0F, 0xF7, 0xD5, 0x7F, 0x5C, 0x3D, 0xA2, 0xFA, 0xAE, 0x6E, 0xFF, 0xDE, 0xDC, 0xF2,
+  0xFF, 0xFF, 0xD3, 0xEF, 0x8B, 0xFA, 0xA1, 0x65, 0xCF, 0xAC, 0xFA, 0x80, 0xF5, 0xB5, 0xEC, 0x39,
+  0xAB, 0xA8, 0x94, 0xAA, 0xAF, 0x7F, 0xAB, 0xDF, 0xE3, 0xF6, 0xF2, 0xEB, 0xF6, 0x79, 0xFA, 0xFA,
+  0x17, 0xD9, 0xBE, 0xAE, 0x7E, 0x33, 0x6B, 0x56, 0xA1, 0xBA, 0xB0, 0xB9, 0xDB, 0x2E, 0x58, 0x52,
+  0xFD, 0x8C, 0xB7, 0x17, 0xAA, 0x15, 0x3A, 0xD6, 0x77, 0xFD, 0xF2, 0xB7, 0x8F, 0xDB, 0x15, 0xBA,
+  0xFE, 0x78, 0xDB, 0xD7, 0xF5, 0x87, 0xF3, 0xF5, 0xBD, 0xAA, 0xDE, 0x73, 0xF0, 0xA4, 0xE2, 0xF0,
+  0x52, 0xFB, 0xB0, 0xD2, 0xAA, 0x02, 0xDE, 0xF3, 0xFD, 0xF3, 0xE5, 0xCD, 0xE0, 0x36, 0xB7, 0xF0,
+  0x1A, 0x5C, 0x6C, 0xEF, 0x35, 0x85, 0xE6, 0x7F, 0xE8, 0x6E, 0x58, 0xA8, 0x6F, 0xD0, 0xEB, 0x85,
+  0xD7, 0x7B, 0x46, 0xEA, 0xF5, 0x5A, 0xFF, 0x50, 0x3C, 0xD5, 0x97, 0xDE, 0x02, 0x93, 0xF5, 0xB3,
+  0xA2, 0x95, 0xAF, 0xFE, 0x56, 0x3D, 0x99, 0xC7, 0xFB, 0xFA, 0x7F, 0x7A, 0x7A, 0xB9, 0x7B, 0xDC,
+  0x3C, 0xD5, 0x4F, 0x46, 0xF9, 0x73, 0xE3, 0xCE, 0x7E, 0xF9, 0x6B, 0xF5, 0x43, 0xD5, 0xC5, 0xA7,
+  0x75, 0xFD, 0x0B, 0x28, 0x7B, 0x6E, 0xF5, 0xD9, 0x3F, 0xEA, 0x6B, 0xB7, 0xF7, 0xF7, 0xDD, 0xCA,
+  0x54, 0x5F, 0xFD, 0x65, 0x7B, 0xF5, 0x75, 0x69, 0x38, 0x57, 0xCD, 0xD2, 0xEA, 0xDD, 0x3F, 0xDD,
+  0xBF, 0x3C, 0xB6, 0x4F, 0x1D, 0xA2, 0x82, 0xF6, 0xCD, 0x13, 0xC6, 0x80, 0xA0, 0xD4, 0xB9, 0x52,
+  0x83, 0x6F, 0xF0, 0xB2, 0xB9, 0x2B, 0xDD, 0xC3, 0x52, 0xF5, 0x63, 0xD8, 0x7E, 0x85, 0x47, 0x6E,
+  0xD7, 0xAF, 0x2F, 0x77, 0x77, 0xE2, 0xDB, 0x74, 0xB7, 0xF9, 0xF8, 0xE9, 0xB9, 0xBA, 0x51, 0x86,
+  0xDF, 0x28, 0x95, 0x7D, 0x79, 0x5D, 0x0D, 0xAB, 0x1E, 0x0E, 0xA9, 0xC6, 0x61, 0xFE, 0xD5, 0x0D,
+  0x56, 0xF0, 0xD5, 0x6D, 0xBE, 0x5B, 0xD9, 0x57, 0xB7, 0x02, 0x56, 0xCC, 0xBF, 0xBA, 0xBB, 0xBE,
+  0xB8, 0xD6, 0x77, 0x5F, 0xDC, 0xFA, 0xAF, 0xF9, 0x17, 0xD7, 0xAE, 0x14, 0xFB, 0xE2, 0x6A, 0x5B,
+  0xBF, 0x79, 0xFD, 0x5B, 0x5D, 0x7D, 0xDA, 0xDC, 0xDC, 0xF4, 0xAB, 0xFA, 0x4B, 0xDD, 0xAA, 0x4F,
+  0xD5, 0x6D, 0xA9, 0xAE, 0xAE, 0xBF, 0xF6, 0x77, 0xBD, 0xBF, 0xD4, 0xDD, 0xFA, 0xEB, 0xF5, 0x97,
+  0x87, 0xFB, 0xEA, 0xDB, 0xD5, 0x2C, 0x6A, 0x70, 0xDD, 0x5D, 0xA9, 0xD6, 0x50, 0x5A, 0x35, 0x77,
+  0xA1, 0x7A, 0xDF, 0xCD, 0xF3, 0xC5, 0xE3, 0x65, 0xF3, 0x09, 0xAA, 0xDF, 0xF8, 0xD3, 0xE5, 0xDD,
+  0xD5, 0xFA, 0xE2, 0xFE, 0xC3, 0xEB, 0xA5, 0x45, 0xB0, 0x8B, 0x7E, 0xD9, 0xD3, 0xDD, 0xFD, 0x17,
+  0xB6, 0xAC, 0xBD, 0xB4, 0xA8, 0x71, 0xD0, 0x7D, 0x89, 0x14, 0x8B, 0x3A, 0x4D, 0x14, 0xFA, 0xF8,
+  0x52, 0x65, 0x82, 0xE6, 0x01, 0xC5, 0xFA, 0x01, 0x35, 0x2F, 0x9B, 0x07, 0x44, 0x76, 0xA5, 0xAB,
+  0x58, 0x54, 0x42, 0x5E, 0xF2, 0x23, 0xC8, 0x23, 0x40, 0x5E, 0xEA, 0x91, 0xD7, 0xC6, 0x91, 0x13,
+  0x20, 0xAF, 0x89, 0x45, 0x3D, 0xF2, 0xAA, 0xE5, 0xC4, 0xA0, 0x67, 0xDC, 0x34, 0xF2, 0x54, 0x7A,
+  0xCD, 0x08, 0xBB, 0x90, 0xB7, 0xDA, 0x89, 0x3D, 0xE7, 0x3A, 0xEC, 0x11, 0x21, 0xF6, 0x12, 0xC7,
+  0x9E, 0xA9, 0xF1, 0xC2, 0xB1, 0x97, 0x38, 0xF6, 0x9A, 0x55, 0x1C, 0x7B, 0x89, 0x61, 0xAF, 0xBD,
+  0xF9, 0x0C, 0x7B, 0x89, 0x61, 0x2F, 0xB4, 0x58, 0x9F, 0xC4, 0x9E, 0x3A, 0x3A, 0xF6, 0xAA, 0x8C,
+  0xAC, 0x33, 0xF0, 0xA5, 0x3A, 0xB8, 0x96, 0xC0, 0x67, 0x8C, 0x1E, 0x01, 0x9F, 0x9E, 0x00, 0x9F,
+  0x3B, 0x09, 0xF8, 0x48, 0x31, 0xF4, 0xF9, 0x3A, 0x80, 0xE5, 0xE8, 0xD3, 0x24, 0x82, 0x9F, 0x3E,
+  0x28, 0xF0, 0x85, 0xD0, 0x81, 0x2F, 0x88, 0xB0, 0x47, 0x22, 0xEC, 0x91, 0x08, 0x7B, 0x4E, 0x80,
+  0xBD, 0x20, 0xC2, 0x9E, 0x39, 0x3E, 0xF6, 0x5C, 0x8E, 0xBD, 0x2A, 0x98, 0xBB, 0x11, 0xEC, 0xF9,
+  0x38, 0x82, 0x3D, 0xF3, 0x53, 0x06, 0x3E, 0xD7, 0x41, 0xED, 0x73, 0x1B, 0x07, 0x79, 0xCA, 0xF5,
+  0x51, 0x04, 0x3C, 0x3B, 0x1D, 0xF7, 0x34, 0x87, 0x1E, 0x65, 0x81, 0x2F, 0xF6, 0xBB, 0x65, 0xF3,
+  0xC7, 0x0D, 0x7C, 0x14, 0x8F, 0x0E, 0xBE, 0xC0, 0x92, 0xAE, 0x5E, 0xC5, 0x32, 0xF6, 0xAC, 0xB2,
+  0x23, 0xD8, 0xB3, 0x80, 0xBD, 0x98, 0x61, 0x2F, 0x9C, 0x28, 0xE9, 0x3A, 0x96, 0x74, 0x03, 0x03,
+  0x9F, 0xD3, 0xA2, 0xED, 0x9E, 0x20, 0xE9, 0x5A, 0x0E, 0x3E, 0x3D, 0x16, 0xF8, 0x0A, 0xE0, 0x8B,
+  0x08, 0x3E, 0x83, 0xE0, 0x8B, 0x08, 0x3E, 0x83, 0xE0, 0x8B, 0x08, 0xBE, 0x00, 0xE0, 0x8B, 0x00,
+  0xBE, 0xC4, 0xC1, 0x47, 0x05, 0xF0, 0x45, 0x9A, 0x23, 0xEB, 0xC6, 0x2C, 0xF2, 0xA9, 0xB1, 0xC8,
+  0x67, 0xED, 0x58, 0xB1, 0xE1, 0x26, 0xD0, 0x17, 0x27, 0xD1, 0xF7, 0x43, 0xB5, 0xD9, 0x16, 0x85,
+  0x13, 0x1D, 0x03, 0x97, 0x37, 0x0C, 0x12, 0xF4, 0x0B, 0x0C, 0x79, 0x11, 0x0A, 0x0F, 0x0F, 0x81,
+  0x7D, 0xC3, 0xC0, 0xCB, 0x50, 0x68, 0x45, 0x28, 0xB4, 0x22, 0x14, 0xC6, 0x49, 0x14, 0xC6, 0xF6,
+  0xD6, 0x4C, 0x85, 0xC0, 0x18, 0x66, 0xA8, 0x3B, 0x6C, 0x16, 0x02, 0xCD, 0x28, 0x08, 0xC3, 0x58,
+  0xDD, 0xE1, 0x19, 0x08, 0xD5, 0x10, 0x84, 0x55, 0xD9, 0x35, 0x9D, 0x7E, 0xE7, 0x04, 0x61, 0xDA,
+  0x3E, 0xB7, 0xD7, 0x0F, 0xE8, 0xBA, 0xD7, 0x5B, 0x14, 0x52, 0x94, 0x15, 0x20, 0x69, 0x1A, 0x85,
+  0x81, 0xA3, 0xD0, 0x64, 0x28, 0x4C, 0x1D, 0x0A, 0x0D, 0x54, 0x20, 0x06, 0x51, 0xE8, 0x30, 0x11,
+  0x1B, 0x44, 0xA1, 0xC3, 0x44, 0xAC, 0x00, 0x85, 0xED, 0x63, 0xC8, 0x50, 0xE8, 0x01, 0x85, 0x09,
+  0x13, 0x71, 0x29, 0x16, 0xEA, 0x19, 0x76, 0x81, 0xB6, 0xBE, 0x75, 0x83, 0x58, 0x58, 0x25, 0xAC,
+  0x32, 0x0C, 0x1D, 0x8D, 0x55, 0x20, 0x21, 0x87, 0x61, 0x13, 0x12, 0x3A, 0x14, 0xEA, 0x1A, 0xE6,
+  0x27, 0x6B, 0x9D, 0x7A, 0x96, 0x8E, 0xD5, 0xCA, 0x72, 0x0C, 0x06, 0x01, 0x06, 0x65, 0xF9, 0x78,
+  0x67, 0xE7, 0x34, 0xF6, 0x0D, 0x18, 0x07, 0x85, 0x88, 0x46, 0x08, 0x86, 0xBC, 0xDB, 0xD2, 0xAD,
+  0xCA, 0x21, 0x18, 0xF2, 0x6E, 0xCB, 0xF6, 0xEE, 0xE7, 0x08, 0x6C, 0x1E, 0x41, 0x86, 0x40, 0xC7,
+  0x11, 0xA8, 0xA9, 0xCD, 0x18, 0x53, 0x71, 0xD0, 0xF8, 0xA3, 0x23, 0x30, 0xE5, 0x00, 0xAC, 0xC2,
+  0xC4, 0x48, 0x09, 0xEC, 0xEC, 0x58, 0x19, 0x12, 0x73, 0x00, 0x52, 0xFD, 0x24, 0x3A, 0x00, 0x9A,
+  0x93, 0xF6, 0xEE, 0x5D, 0x07, 0xB8, 0xD7, 0x5A, 0x84, 0x6F, 0x07, 0xA5, 0xF8, 0xE3, 0x9D, 0xFB,
+  0x3D, 0xDB, 0x7F, 0x7D, 0x00, 0xF4, 0x9A, 0xA3, 0x8F, 0xB0, 0x12, 0xE9, 0xB6, 0xB1, 0x3D, 0xFA,
+  0x08, 0x2B, 0x91, 0x66, 0x55, 0x86, 0x3E, 0xCA, 0x0B, 0xE3, 0xEE, 0xFE, 0x67, 0xE8, 0xB3, 0xBC,
+  0x10, 0xD9, 0x56, 0xDD, 0x53, 0xE8, 0x73, 0xC7, 0x8F, 0x7F, 0x4D, 0x93, 0x2C, 0xCB, 0xC2, 0x6A,
+  0x04, 0x7D, 0x71, 0xAC, 0x10, 0x49, 0x1C, 0x7D, 0x6E, 0x80, 0x3E, 0x3B, 0xDC, 0x09, 0xBE, 0x39,
+  0xFA, 0x12, 0x6B, 0xC2, 0x58, 0x84, 0x9F, 0x97, 0x0C, 0x8E, 0x54, 0xFD, 0x99, 0x0E, 0xDB, 0x08,
+  0x7A, 0xEA, 0x10, 0x18, 0x23, 0x22, 0xD0, 0x71, 0x04, 0x26, 0xDC, 0x08, 0x52, 0x0E, 0xCA, 0x6E,
+  0x15, 0x43, 0xA0, 0xE3, 0x08, 0xB4, 0xB0, 0x0F, 0xB4, 0x59, 0x67, 0xA6, 0xED, 0x64, 0x8B, 0xF6,
+  0x81, 0xF6, 0xF8, 0xFD, 0xE7, 0xB6, 0x44, 0x1C, 0x64, 0x60, 0x3D, 0x06, 0x41, 0xAF, 0x47, 0xAA,
+  0x11, 0x62, 0xA3, 0x0F, 0x93, 0x05, 0xC0, 0x30, 0xDC, 0x07, 0x8E, 0x40, 0xF0, 0xCF, 0x3F, 0x80,
+  0xBD, 0xC4, 0xB1, 0xE7, 0x59, 0x25, 0x9C, 0xD5, 0x20, 0x64, 0x70, 0xFB, 0x67, 0x64, 0x7D, 0x18,
+  0xC1, 0xF6, 0xCF, 0xEF, 0x2E, 0x85, 0x55, 0x8F, 0xBD, 0xC4, 0xB0, 0xD7, 0xA4, 0xED, 0x7C, 0x68,
+  0xA9, 0x61, 0xF7, 0xA7, 0xF2, 0xAE, 0x60, 0xB7, 0x28, 0x43, 0x9E, 0xC1, 0xD8, 0x17, 0x60, 0xEF,
+  0xA7, 0x21, 0xF6, 0x79, 0xD9, 0xDE, 0x2F, 0xBA, 0x39, 0xEA, 0xE0, 0xC4, 0xEA, 0xE0, 0x91, 0xBD,
+  0x9F, 0x77, 0x23, 0x25, 0x08, 0x11, 0x47, 0x9E, 0x1F, 0x20, 0x2F, 0x0A, 0xF6, 0x7E, 0x33, 0x20,
+  0x2F, 0xB1, 0x4D, 0x9F, 0xC3, 0xD6, 0xB3, 0x95, 0x21, 0xCF, 0x1F, 0x1C, 0xF5, 0xFA, 0x0E, 0xA0,
+  0xE1, 0x63, 0xB7, 0x06, 0xB5, 0x39, 0xF2, 0x0C, 0x6C, 0xFA, 0xD4, 0xF6, 0x5B, 0xD4, 0x23, 0xCF,
+  0xC0, 0x9E, 0xAF, 0xB9, 0xEB, 0x39, 0xF2, 0x22, 0xEC, 0xF9, 0xF2, 0x5D, 0x60, 0xBB, 0x79, 0x14,
+  0xED, 0xF9, 0x6C, 0x9A, 0xA3, 0xEA, 0x30, 0xAC, 0xEA, 0x18, 0x8B, 0x79, 0x69, 0xA4, 0xEA, 0x20,
+  0x36, 0xF7, 0x70, 0xC3, 0xAA, 0xC3, 0xD2, 0x69, 0x90, 0x17, 0x58, 0xBE, 0x25, 0x68, 0x3D, 0x1B,
+  0x92, 0xB5, 0xFF, 0x0A, 0x31, 0x2F, 0xED, 0xB1, 0xDD, 0xEB, 0x7B, 0x7F, 0xD0, 0x75, 0x69, 0x02,
+  0x57, 0x0E, 0x3B, 0x0F, 0xB0, 0x63, 0x21, 0xB0, 0x5B, 0x94, 0xC1, 0xCE, 0x41, 0xA9, 0xD1, 0xDE,
+  0xF7, 0x0C, 0x76, 0x8A, 0x97, 0x1A, 0x46, 0xC9, 0x60, 0x77, 0xFC, 0x8E, 0x0B, 0x29, 0x56, 0x6A,
+  0x84, 0xB1, 0x51, 0x6F, 0xD0, 0x23, 0xA5, 0x06, 0x99, 0xDD, 0xA8, 0x33, 0xA7, 0x40, 0x9D, 0x67,
+  0x8D, 0x16, 0xD5, 0x51, 0x0E, 0x3A, 0x8E, 0x81, 0x93, 0x71, 0x0C, 0xA6, 0x77, 0x79, 0x3B, 0x51,
+  0xD7, 0xCF, 0x79, 0x35, 0xEF, 0xB2, 0x14, 0x50, 0xE7, 0xF2, 0x82, 0xA2, 0x8C, 0x3A, 0x97, 0x4F,
+  0x36, 0xC6, 0x50, 0x67, 0x04, 0xA8, 0x73, 0xA2, 0x12, 0x63, 0x16, 0xD8, 0xE5, 0x43, 0x5E, 0xBF,
+  0xB2, 0x23, 0xB0, 0xF3, 0x23, 0x35, 0x06, 0x59, 0x0E, 0xBB, 0x41, 0xA3, 0xCF, 0x4A, 0x5A, 0x2C,
+  0xB3, 0xC0, 0x2E, 0x30, 0xD8, 0xF1, 0x0D, 0x9E, 0x8E, 0xB2, 0x09, 0xEF, 0x34, 0xB5, 0x65, 0x82,
+  0x60, 0xD0, 0x87, 0xBB, 0xC4, 0x59, 0x69, 0xD8, 0x5A, 0x31, 0xD8, 0x5A, 0xC1, 0xCE, 0x8A, 0xC1,
+  0xCE, 0x8A, 0x83, 0xDE, 0x9E, 0xC5, 0xCE, 0x4A, 0xCE, 0x75, 0x69, 0x29, 0x70, 0xA2, 0x70, 0x37,
+  0x43, 0x6D, 0xDB, 0x76, 0xAD, 0x32, 0xE0, 0x8D, 0xC4, 0xBB, 0x9A, 0x35, 0x57, 0x06, 0x1E, 0x9B,
+  0x73, 0xF8, 0x61, 0x71, 0xDB, 0x72, 0xE8, 0x26, 0x80, 0xF7, 0xF7, 0xDF, 0xD6, 0x8F, 0x0D, 0xA7,
+  0x6F, 0x1F, 0xE8, 0x55, 0x35, 0x10, 0x83, 0x5E, 0x62, 0x3B, 0x3C, 0x9D, 0x41, 0xCF, 0x02, 0xF4,
+  0xAC, 0x20, 0xCD, 0xAA, 0x2D, 0xCC, 0x7E, 0x34, 0xE0, 0xB9, 0xBE, 0xA6, 0x25, 0x5E, 0x57, 0x18,
+  0x28, 0x69, 0xAB, 0x3D, 0x19, 0x9F, 0xB0, 0x19, 0xA8, 0x68, 0xDB, 0x45, 0x19, 0xEE, 0x3C, 0x54,
+  0xB4, 0xED, 0x8D, 0x1F, 0xE2, 0x4E, 0xF1, 0x82, 0xD6, 0x68, 0x1C, 0xAF, 0x95, 0x60, 0xA7, 0x67,
+  0xD8, 0xDC, 0x19, 0x36, 0x5E, 0xD3, 0xA3, 0xB0, 0x33, 0x63, 0x65, 0x85, 0xE7, 0xB0, 0x53, 0x59,
+  0xBC, 0x9B, 0xEE, 0xA9, 0xCC, 0x02, 0x3B, 0xD7, 0xCD, 0xD1, 0x3E, 0xE7, 0x04, 0xAB, 0xAE, 0xA2,
+  0xB5, 0xB2, 0x3C, 0x1B, 0x0E, 0xCB, 0xB3, 0x7D, 0x39, 0x4B, 0xBC, 0x95, 0x62, 0x80, 0xCA, 0x57,
+  0x45, 0x32, 0xDE, 0x49, 0x61, 0x65, 0x46, 0xB7, 0x88, 0xC1, 0x8E, 0x13, 0xF9, 0xDA, 0x1B, 0x9F,
+  0xC3, 0x4E, 0x01, 0xEC, 0x44, 0x7D, 0x94, 0x19, 0xA2, 0x5D, 0x53, 0xCD, 0x64, 0x94, 0x02, 0x1A,
+  0x41, 0x5D, 0x18, 0x2B, 0x29, 0x02, 0xCF, 0xB2, 0x2E, 0xDB, 0xDC, 0xA5, 0xC9, 0x71, 0xDA, 0xBE,
+  0xA8, 0x7B, 0x9D, 0xA4, 0x4D, 0xE1, 0x2E, 0xB2, 0x0D, 0x9E, 0x05, 0xE0, 0x69, 0x6F, 0x44, 0xF1,
+  0x6E, 0xBA, 0xA0, 0xDD, 0xC9, 0xA5, 0xEA, 0xBB, 0xC8, 0x11, 0xCB, 0x0A, 0x88, 0x77, 0x1E, 0x9A,
+  0xC8, 0x1A, 0xE3, 0x9D, 0x87, 0x1E, 0xB2, 0xC3, 0x78, 0x47, 0xD0, 0x43, 0xC6, 0x80, 0x47, 0xB2,
+  0x1E, 0x72, 0x3C, 0xFE, 0x04, 0xA3, 0x65, 0x56, 0x0E, 0x02, 0x1E, 0x8D, 0x41, 0x2F, 0xA9, 0xB1,
+  0xBA, 0x22, 0x72, 0xE8, 0x51, 0x06, 0x3D, 0x3A, 0x15, 0xF4, 0x02, 0x83, 0x9E, 0xEE, 0xBA, 0x7A,
+  0x7B, 0xF5, 0x52, 0x44, 0x31, 0x6F, 0x62, 0x88, 0x1B, 0xFA, 0xF2, 0x02, 0xB4, 0x07, 0x1A, 0xBB,
+  0x78, 0x6E, 0xBB, 0x3D, 0x1D, 0xA0, 0x0F, 0xBA, 0x78, 0xCD, 0x22, 0x86, 0x3E, 0xDE, 0xC5, 0x6B,
+  0x6F, 0x3F, 0x43, 0x5F, 0x82, 0xF2, 0xC2, 0x48, 0xBA, 0x78, 0x6E, 0x06, 0x0E, 0x29, 0xB1, 0xAA,
+  0x36, 0xAE, 0xD2, 0x08, 0xFA, 0xEC, 0x58, 0x79, 0x91, 0x78, 0x17, 0x6F, 0x40, 0xE3, 0x33, 0x0D,
+  0x7B, 0xE4, 0x34, 0xE8, 0x9B, 0xE6, 0xB1, 0xBC, 0x05, 0x77, 0x7E, 0x28, 0x7A, 0xC1, 0x26, 0x1E,
+  0x9F, 0x9D, 0x19, 0x93, 0xB7, 0xEC, 0xB6, 0x8B, 0x78, 0x13, 0xCF, 0x43, 0x13, 0x8F, 0x73, 0xF8,
+  0xDA, 0x3B, 0xCF, 0x9A, 0x78, 0xC4, 0x9A, 0x78, 0xB1, 0xDD, 0x0A, 0x4F, 0xEE, 0xF3, 0x8E, 0x0F,
+  0x3C, 0x31, 0x81, 0x25, 0xC5, 0x91, 0xEA, 0x42, 0xB3, 0xB9, 0x85, 0xCE, 0xBA, 0xC7, 0x5E, 0x44,
+  0xA2, 0x7A, 0xBE, 0xFA, 0xF4, 0xED, 0xAC, 0xFE, 0x90, 0x67, 0x0F, 0xF7, 0x4F, 0x4F, 0x9B, 0xFF,
+  0xDC, 0xAC, 0xF7, 0xC4, 0x60, 0xE0, 0x33, 0x34, 0x6F, 0x58, 0xF2, 0x0D, 0x2C, 0xF9, 0x72, 0x10,
+  0x8A, 0x14, 0x1C, 0x22, 0x22, 0xF3, 0x44, 0x37, 0x79, 0xA7, 0x88, 0xA3, 0xA1, 0x36, 0x70, 0xF5,
+  0x15, 0xCC, 0xD0, 0x54, 0x7E, 0xA9, 0x5B, 0x95, 0x41, 0x51, 0x63, 0x3F, 0xD9, 0xC3, 0x0C, 0xCD,
+  0x40, 0x3F, 0xD9, 0xCB, 0xF6, 0x7E, 0xE1, 0xF8, 0x74, 0xD2, 0x42, 0x06, 0x2E, 0xF7, 0x93, 0x93,
+  0xA2, 0x91, 0x92, 0x43, 0xD3, 0xEE, 0x31, 0xEE, 0x34, 0x9D, 0xF4, 0x0D, 0xB0, 0x38, 0xE0, 0xAF,
+  0x6C, 0x2B, 0x7A, 0x18, 0xE8, 0xEA, 0x24, 0x0A, 0x89, 0x87, 0xB1, 0xEA, 0x6B, 0x12, 0xC1, 0x96,
+  0x5C, 0x0A, 0x6C, 0x96, 0xE2, 0x34, 0x17, 0xC8, 0xA5, 0xC5, 0x69, 0x2E, 0xAF, 0x7D, 0x8B, 0xD3,
+  0x5C, 0xCE, 0x2D, 0xC5, 0x69, 0xAE, 0x91, 0x15, 0xBF, 0x76, 0x86, 0xBD, 0xA0, 0xCB, 0xCB, 0x10,
+  0xED, 0x46, 0x91, 0xE8, 0x46, 0xCA, 0x10, 0xAD, 0x39, 0x9F, 0x6A, 0x98, 0x8D, 0xCD, 0xCF, 0x81,
+  0x44, 0x97, 0x47, 0xC5, 0xBE, 0x21, 0xD3, 0x05, 0x45, 0x7B, 0x2C, 0x5E, 0xCB, 0xE0, 0x75, 0x71,
+  0x5B, 0xD8, 0x57, 0xC3, 0x86, 0x37, 0x61, 0x96, 0xB8, 0x2F, 0xD4, 0xD8, 0x85, 0x59, 0xE2, 0xC6,
+  0x50, 0x63, 0x1B, 0x46, 0x61, 0x7E, 0x86, 0x36, 0xCC, 0xD2, 0x41, 0x7E, 0x2E, 0xF4, 0x61, 0x4A,
+  0x1B, 0x43, 0x9A, 0x23, 0x3F, 0x7B, 0x96, 0x9F, 0xCB, 0x1C, 0xFB, 0xAA, 0x28, 0x19, 0xA9, 0x4A,
+  0x34, 0xD7, 0x77, 0xA8, 0x4C, 0x15, 0x9D, 0x0D, 0xD9, 0x4E, 0x07, 0xC5, 0xC4, 0x88, 0x06, 0x0E,
+  0x87, 0x6E, 0x47, 0x1B, 0x7F, 0x4C, 0xA8, 0xA3, 0x7B, 0x28, 0x7A, 0xC8, 0xCF, 0x06, 0xF2, 0xB3,
+  0xC6, 0xB9, 0xDB, 0xD2, 0x40, 0x7E, 0xD6, 0x38, 0x78, 0x6B, 0x9F, 0x43, 0x8E, 0x45, 0x9C, 0xBC,
+  0x79, 0x48, 0xD0, 0xC2, 0xC9, 0x9B, 0x9E, 0x63, 0xDE, 0x6B, 0xD9, 0xBC, 0x57, 0x7F, 0xFF, 0x77,
+  0x83, 0x46, 0x2E, 0xEB, 0xAE, 0xE9, 0xFE, 0x20, 0xEB, 0x7E, 0xAD, 0x5C, 0x50, 0xD6, 0xDD, 0x74,
+  0xE9, 0x87, 0xB2, 0x6E, 0x5B, 0x7F, 0xC4, 0x5C, 0xD6, 0x6D, 0x72, 0x59, 0x77, 0xC3, 0x37, 0xCC,
+  0x64, 0xDD, 0x29, 0x97, 0x75, 0x87, 0x1F, 0x97, 0x75, 0xB7, 0x85, 0x13, 0xCA, 0xBA, 0xDD, 0x71,
+  0x65, 0xDD, 0x47, 0x6C, 0x6E, 0x4E, 0x2A, 0xBA, 0x7D, 0x41, 0xD1, 0x4D, 0xA0, 0xE8, 0x26, 0x55,
+  0xDD, 0xB7, 0x82, 0xA2, 0xDB, 0xC5, 0x49, 0x45, 0x77, 0x22, 0x5D, 0x2C, 0x4B, 0x09, 0x15, 0xDD,
+  0x2A, 0xE3, 0x35, 0xD1, 0x89, 0x45, 0x16, 0x83, 0x39, 0xEB, 0x76, 0x9C, 0xCC, 0x03, 0x0F, 0x09,
+  0xBA, 0x72, 0x6D, 0xFD, 0x3E, 0x31, 0xEC, 0x9F, 0xD0, 0xFA, 0xC4, 0x9E, 0x66, 0xE2, 0x61, 0x3B,
+  0x66, 0x30, 0x07, 0x7A, 0x2C, 0x0C, 0x0C, 0xE6, 0x40, 0x8F, 0x2A, 0x0B, 0x85, 0x1C, 0x27, 0x82,
+  0xCA, 0xC0, 0x43, 0x12, 0x24, 0xAC, 0x0C, 0x4A, 0x49, 0xD0, 0xCC, 0x50, 0x19, 0x78, 0xC6, 0x34,
+  0x19, 0x9B, 0x81, 0x25, 0x2A, 0x1B, 0x0B, 0x10, 0xC8, 0xBB, 0x55, 0xE6, 0x2B, 0xA0, 0x05, 0xDD,
+  0x91, 0x99, 0x51, 0x68, 0x58, 0x49, 0xC0, 0x3B, 0x74, 0x14, 0x83, 0x00, 0x86, 0xBA, 0x24, 0xF6,
+  0xD9, 0x83, 0x73, 0x32, 0x48, 0x7E, 0xD6, 0x21, 0x06, 0xF9, 0x58, 0x42, 0x7B, 0x68, 0x93, 0x2C,
+  0x71, 0x2E, 0xD1, 0xAE, 0x62, 0xFB, 0x30, 0x3E, 0x97, 0x68, 0x9F, 0x01, 0x83, 0xA0, 0x02, 0x08,
+  0xCA, 0xFA, 0x24, 0x33, 0x40, 0xB0, 0xD9, 0x90, 0x64, 0x42, 0xDB, 0x72, 0x83, 0x2E, 0x51, 0xD9,
+  0x61, 0x80, 0x50, 0xE4, 0xCD, 0x95, 0x3E, 0xD3, 0x22, 0xEF, 0xD3, 0x2A, 0x7D, 0x92, 0xA4, 0x28,
+  0x95, 0x04, 0x42, 0xA1, 0xCF, 0x80, 0x93, 0xA9, 0x7C, 0x40, 0xEB, 0x5D, 0x54, 0xF9, 0x80, 0xD6,
+  0xBB, 0xA8, 0xF2, 0xE1, 0x5A, 0xEF, 0x92, 0xCA, 0x47, 0xA4, 0xF5, 0x9E, 0x63, 0x24, 0x2B, 0x55,
+  0xF9, 0x24, 0x5D, 0xF6, 0x19, 0xA0, 0x92, 0xD6, 0xDB, 0x0C, 0x14, 0x8F, 0x49, 0x54, 0x96, 0xCE,
+  0x07, 0xC1, 0x98, 0x8F, 0x66, 0x49, 0x03, 0x07, 0x8A, 0xAC, 0x24, 0x19, 0xEB, 0x52, 0x11, 0xC0,
+  0x93, 0xB1, 0xBC, 0x20, 0x2D, 0x48, 0x1E, 0xB9, 0x47, 0x92, 0xB6, 0x25, 0xE1, 0xAD, 0xE1, 0x30,
+  0xB4, 0x25, 0xE1, 0xAD, 0x61, 0x30, 0x6C, 0x1F, 0x03, 0x93, 0x3C, 0x1A, 0x06, 0xC3, 0x28, 0xAB,
+  0x48, 0xF5, 0x0C, 0x54, 0x77, 0xDD, 0xBD, 0xDE, 0xDA, 0x5D, 0x94, 0x99, 0x50, 0x49, 0x97, 0x2D,
+  0x07, 0x08, 0x65, 0xDF, 0xCD, 0xD4, 0x68, 0x10, 0x09, 0x7F, 0xBA, 0x3D, 0x21, 0x64, 0xE3, 0x20,
+  0x99, 0x97, 0x91, 0x80, 0x01, 0x3A, 0x31, 0x2F, 0xF3, 0xFD, 0xD8, 0x82, 0xF8, 0xBC, 0x6C, 0xD9,
+  0xB4, 0x2E, 0x78, 0x38, 0x2C, 0x6C, 0x0A, 0x03, 0x86, 0xC3, 0xC2, 0xA6, 0x30, 0x60, 0x38, 0xC4,
+  0x4D, 0x61, 0x80, 0x6A, 0x54, 0xB4, 0x29, 0x9C, 0x23, 0x23, 0x7B, 0x56, 0x8E, 0x8E, 0x31, 0xF2,
+  0x92, 0x29, 0xDB, 0x0F, 0x10, 0x0A, 0xC0, 0xF3, 0x2E, 0x9D, 0x12, 0xB4, 0x46, 0xF6, 0xA3, 0xE4,
+  0x6D, 0x01, 0x38, 0xC9, 0x40, 0x4E, 0x2C, 0x0E, 0xF2, 0x06, 0xB1, 0x8C, 0x81, 0x2C, 0x2A, 0x4A,
+  0x76, 0x36, 0x43, 0x06, 0x2C, 0x15, 0x5F, 0xC8, 0xC6, 0x20, 0x39, 0x73, 0xA5, 0x66, 0x08, 0x48,
+  0xCE, 0x5C, 0xA9, 0x19, 0x02, 0x8D, 0x39, 0x55, 0x68, 0x86, 0x70, 0xF3, 0x8B, 0x24, 0x6B, 0x86,
+  0xC4, 0x19, 0x78, 0x79, 0x94, 0x13, 0xA4, 0xAA, 0x5F, 0x65, 0xA4, 0x47, 0x6C, 0xCA, 0xFE, 0x03,
+  0x04, 0xD2, 0xEF, 0xFD, 0x6B, 0x92, 0x59, 0xD0, 0x17, 0x19, 0xFA, 0x2C, 0xCA, 0x6D, 0x93, 0x24,
+  0xFA, 0xE9, 0x03, 0x77, 0x82, 0xA9, 0xC7, 0x5E, 0x2A, 0x60, 0xEF, 0x8F, 0x52, 0x8B, 0xCC, 0x20,
+  0xF9, 0x31, 0x2C, 0xF2, 0xD1, 0x88, 0xDA, 0x36, 0x99, 0xB2, 0xEB, 0x00, 0x81, 0xDC, 0x3B, 0xB7,
+  0xD9, 0x33, 0x02, 0x6E, 0xDE, 0x2C, 0x5C, 0xE4, 0x4C, 0x78, 0x91, 0xA0, 0x00, 0xD1, 0x4A, 0x12,
+  0xF5, 0x74, 0x89, 0x20, 0xB5, 0x07, 0xEE, 0x7C, 0xDA, 0x51, 0x81, 0x68, 0xC4, 0x5D, 0xC4, 0x94,
+  0xAB, 0x11, 0x77, 0xB1, 0x20, 0x72, 0x04, 0xDC, 0x19, 0xC8, 0xB8, 0x0E, 0x70, 0x67, 0x64, 0x03,
+  0xDA, 0x19, 0x66, 0x11, 0x89, 0x31, 0x91, 0xED, 0x58, 0xFD, 0x61, 0xCB, 0x2E, 0x03, 0x04, 0x22,
+  0x6F, 0x9D, 0xB9, 0x0C, 0x38, 0x81, 0xC8, 0x7B, 0x16, 0xD8, 0xA9, 0x1C, 0x76, 0x3C, 0xD9, 0x6A,
+  0x89, 0xC4, 0x91, 0xA8, 0x44, 0x50, 0xD9, 0x03, 0x76, 0x71, 0xC0, 0x43, 0x06, 0x6D, 0xAD, 0x42,
+  0x02, 0xBC, 0x42, 0x75, 0xB7, 0x82, 0xC2, 0xB7, 0x5D, 0xC5, 0x78, 0x01, 0xE0, 0x2D, 0xE0, 0x80,
+  0x99, 0x67, 0x78, 0xDD, 0xBB, 0xAD, 0xB3, 0x4F, 0xC0, 0x0B, 0x48, 0xAC, 0xDE, 0x18, 0xB3, 0x38,
+  0x4B, 0xB6, 0xEC, 0x2D, 0x40, 0xA0, 0xEE, 0x36, 0xC3, 0xAA, 0xD7, 0xC4, 0x61, 0xA2, 0x7D, 0x3B,
+  0xD8, 0x11, 0x31, 0x9D, 0x59, 0xC0, 0x78, 0x17, 0x95, 0x28, 0xDE, 0x1D, 0x06, 0xBC, 0x01, 0x25,
+  0x8F, 0x90, 0x19, 0x05, 0x6E, 0xC0, 0xBA, 0xC0, 0x8C, 0xE2, 0x85, 0xAE, 0xD1, 0x05, 0x66, 0x14,
+  0xAF, 0x73, 0xDB, 0x1B, 0xCF, 0x98, 0x51, 0xBC, 0xBE, 0x08, 0xC2, 0x2C, 0x3B, 0x47, 0x79, 0xE1,
+  0x59, 0x79, 0x31, 0x16, 0xED, 0xCA, 0xA6, 0x02, 0x54, 0x50, 0x74, 0xBB, 0x0C, 0x76, 0xD3, 0x82,
+  0x9F, 0x59, 0x08, 0xF0, 0x44, 0xAC, 0xCD, 0x12, 0x20, 0xE2, 0x05, 0x81, 0xE4, 0x47, 0x84, 0xBB,
+  0xDD, 0xD5, 0x85, 0xEF, 0x25, 0x3F, 0xDA, 0x02, 0xF2, 0x80, 0x8A, 0x5C, 0x12, 0xD6, 0x02, 0x15,
+  0xB9, 0x24, 0xAC, 0x05, 0xFA, 0x49, 0x49, 0x58, 0xCB, 0xE9, 0x27, 0x42, 0x61, 0xAD, 0x9E, 0x41,
+  0x6B, 0xE6, 0x59, 0xAF, 0xD9, 0x8F, 0x45, 0x3C, 0x57, 0x36, 0x13, 0x20, 0x90, 0x74, 0xDB, 0x8C,
+  0x05, 0x9F, 0xD9, 0x28, 0xBF, 0x25, 0xF4, 0x3C, 0x1B, 0x73, 0xF4, 0xFE, 0xA2, 0xBD, 0x95, 0x85,
+  0xC4, 0xD3, 0x0C, 0x3D, 0xD0, 0x0B, 0xD0, 0x73, 0x3B, 0xA7, 0x6D, 0xAE, 0xA7, 0xE1, 0x79, 0xCE,
+  0x38, 0x41, 0xEE, 0x93, 0x41, 0x2B, 0x65, 0xA4, 0x3E, 0x19, 0x74, 0x52, 0xB6, 0x48, 0x83, 0x47,
+  0x23, 0x65, 0x02, 0xEC, 0x15, 0x8C, 0x94, 0x8B, 0x44, 0xE4, 0xE3, 0x97, 0xB5, 0x89, 0xF1, 0x41,
+  0xDD, 0x08, 0x0B, 0x3E, 0xB9, 0xB2, 0x9B, 0x00, 0x81, 0xA6, 0xDB, 0x67, 0xEA, 0x5A, 0x33, 0x64,
+  0xC1, 0xBF, 0xAD, 0xEC, 0x87, 0xF9, 0x89, 0x02, 0x05, 0xDE, 0x48, 0xC6, 0x1B, 0xA2, 0xD6, 0xF2,
+  0x04, 0x05, 0x7E, 0xA0, 0xEB, 0xE6, 0xF9, 0xD6, 0xA0, 0xC2, 0x36, 0x00, 0x05, 0xDE, 0xA0, 0xC2,
+  0x36, 0x00, 0x05, 0xDE, 0xA3, 0xC2, 0xD6, 0x70, 0x0A, 0x3C, 0xEA, 0x1C, 0xB5, 0x90, 0x01, 0x3F,
+  0x87, 0x87, 0x4F, 0xBE, 0xCB, 0xD3, 0x63, 0xF3, 0x35, 0x57, 0x36, 0x13, 0x20, 0x90, 0x75, 0xFB,
+  0x4C, 0x5F, 0x6B, 0x4F, 0x15, 0xF3, 0x0A, 0x74, 0x4F, 0xD8, 0xE7, 0x79, 0x49, 0xBE, 0x3D, 0xB4,
+  0xC0, 0xB0, 0x7D, 0x81, 0x01, 0x0C, 0x78, 0x1C, 0xAC, 0x99, 0x08, 0x11, 0x0F, 0xE7, 0x6A, 0xED,
+  0x22, 0x86, 0x3B, 0x10, 0xD8, 0x5A, 0x1E, 0xF1, 0x50, 0xD8, 0x6D, 0x64, 0xCE, 0xF1, 0x73, 0x78,
+  0xE7, 0x39, 0x36, 0x55, 0x73, 0x63, 0xDC, 0x02, 0x5F, 0xF6, 0x13, 0x20, 0x10, 0x76, 0x87, 0x4C,
+  0xE8, 0x68, 0x05, 0xCE, 0x3D, 0x33, 0xE9, 0x6B, 0xA7, 0x06, 0xBA, 0x32, 0x03, 0xD1, 0x83, 0x0B,
+  0xDB, 0x3E, 0xD3, 0x12, 0xE7, 0x14, 0xE0, 0xA1, 0x05, 0x26, 0xE5, 0xD1, 0x6D, 0xBB, 0x28, 0xC7,
+  0x5D, 0x02, 0xE3, 0x1E, 0x26, 0xF5, 0xEE, 0xEE, 0xFC, 0x10, 0x77, 0x04, 0x4A, 0x47, 0x23, 0x74,
+  0x8D, 0x9F, 0xC1, 0xBF, 0x56, 0x3C, 0xCD, 0xF5, 0x65, 0x43, 0x01, 0x2A, 0xE8, 0xBA, 0x7D, 0x96,
+  0x69, 0x25, 0xA6, 0x65, 0x3F, 0x4E, 0xEC, 0x6C, 0x30, 0x38, 0x4D, 0xEB, 0x9C, 0xD2, 0x78, 0x8B,
+  0x58, 0x9D, 0xBA, 0xE4, 0xDC, 0xB8, 0x57, 0xA9, 0x31, 0x28, 0x72, 0x39, 0xB7, 0xCA, 0xA0, 0x85,
+  0x0F, 0xB6, 0xF4, 0x98, 0x1E, 0xA8, 0x5B, 0xC4, 0x62, 0x1F, 0x97, 0x5C, 0x58, 0xE8, 0xE8, 0xE5,
+  0x4E, 0xA2, 0x83, 0xB2, 0x66, 0xD2, 0xB5, 0x71, 0x06, 0x0C, 0x4A, 0x45, 0xDE, 0x29, 0x94, 0xBD,
+  0x05, 0xA8, 0x20, 0xF2, 0xFE, 0xE9, 0x30, 0xE8, 0x72, 0x0C, 0x46, 0x1C, 0x67, 0x48, 0x20, 0x48,
+  0x25, 0xB1, 0x05, 0x87, 0xE0, 0xEE, 0x38, 0xD8, 0xF3, 0xFB, 0x50, 0xF0, 0xFD, 0x87, 0x80, 0xA0,
+  0x3B, 0xBE, 0xD4, 0x22, 0xB0, 0x29, 0x9A, 0x1E, 0x1B, 0x65, 0x84, 0xB2, 0xCD, 0x00, 0x81, 0xE0,
+  0xDB, 0x0F, 0x9B, 0x7B, 0xD6, 0x0C, 0xDD, 0x7C, 0x46, 0xB9, 0x04, 0xF3, 0x6B, 0x7E, 0xA6, 0x7B,
+  0x2E, 0x64, 0x65, 0x4D, 0x97, 0x69, 0x18, 0xEE, 0x6C, 0xB9, 0x0C, 0x48, 0xA6, 0x3C, 0x19, 0x1B,
+  0x6C, 0xF6, 0x85, 0x7C, 0x78, 0xBB, 0x5D, 0xC4, 0x8B, 0x0F, 0x6E, 0xEF, 0xE3, 0xA1, 0xD9, 0xD7,
+  0x3E, 0x88, 0x1C, 0x85, 0x06, 0x8A, 0x0F, 0x91, 0xBB, 0x8F, 0x9F, 0x85, 0x4B, 0x20, 0xEC, 0xB8,
+  0x84, 0xB2, 0xEF, 0x00, 0x81, 0xF8, 0xDB, 0x67, 0xE2, 0x6F, 0x23, 0x22, 0x98, 0xBE, 0x81, 0x0C,
+  0x72, 0xEA, 0x34, 0x21, 0x32, 0x32, 0x62, 0x81, 0xA0, 0x0A, 0x96, 0xE6, 0x63, 0x8D, 0x38, 0x04,
+  0x1D, 0x78, 0x80, 0xA6, 0x33, 0x52, 0x9D, 0xDB, 0x45, 0x0C, 0x87, 0xA0, 0x03, 0x37, 0xBC, 0xE9,
+  0xAC, 0x38, 0xD1, 0x79, 0x6B, 0x1D, 0x79, 0x0A, 0x97, 0x29, 0xE9, 0x51, 0x42, 0x29, 0x96, 0x4D,
+  0x08, 0x08, 0x64, 0xE0, 0x36, 0x4B, 0xC8, 0xEA, 0xE7, 0x08, 0x87, 0x93, 0xC2, 0x33, 0xD2, 0x32,
+  0xD2, 0xFD, 0x61, 0x0E, 0x7B, 0x83, 0xFE, 0x33, 0xB6, 0x00, 0x21, 0x23, 0x5B, 0x88, 0x85, 0x84,
+  0x19, 0xD9, 0x42, 0x2C, 0xB4, 0x98, 0x91, 0x15, 0x8F, 0x85, 0x4B, 0x02, 0x99, 0x4F, 0x92, 0x05,
+  0xC3, 0x19, 0xDA, 0xCF, 0x62, 0xC9, 0x59, 0x2C, 0x5B, 0x11, 0x10, 0x48, 0xC2, 0x6D, 0x36, 0xE6,
+  0x4D, 0x82, 0x23, 0x0D, 0xFE, 0x52, 0xE3, 0xA8, 0x81, 0xE0, 0x7E, 0xC8, 0xD3, 0x89, 0x21, 0x8F,
+  0xE2, 0xBE, 0x2C, 0x67, 0x23, 0xD2, 0xDE, 0xEA, 0x92, 0xEB, 0xD4, 0x3E, 0x45, 0x71, 0xAF, 0xBD,
+  0x05, 0x15, 0x38, 0x61, 0x13, 0xD0, 0x42, 0x51, 0x4C, 0xD8, 0x04, 0xB4, 0x50, 0x14, 0x5B, 0x9C,
+  0xF5, 0x26, 0x70, 0xB3, 0x25, 0x98, 0xF5, 0xC6, 0x93, 0x1D, 0x29, 0x24, 0xAF, 0x8A, 0x63, 0xD9,
+  0x8F, 0x80, 0x40, 0x03, 0xAE, 0x33, 0x96, 0x7D, 0x10, 0x24, 0xE2, 0xD9, 0xC0, 0xE7, 0x72, 0xF0,
+  0x25, 0xA8, 0x44, 0x44, 0x2E, 0x2C, 0x22, 0x56, 0xE9, 0x6E, 0xA9, 0x91, 0xEF, 0xB3, 0x2F, 0x3A,
+  0xC9, 0x2B, 0x84, 0x1F, 0x21, 0xB5, 0x4A, 0x21, 0xFE, 0x08, 0xF2, 0xAF, 0x46, 0x8E, 0x7D, 0xE0,
+  0xF9, 0x77, 0x69, 0x78, 0x17, 0x5A, 0x7B, 0x4C, 0xC0, 0x45, 0x52, 0xE9, 0x1C, 0x72, 0xDB, 0xC8,
+  0xB8, 0x06, 0x23, 0xE3, 0x8F, 0x54, 0xB6, 0x20, 0x20, 0x10, 0x7E, 0xEB, 0x6C, 0xE8, 0xEB, 0x05,
+  0x94, 0xD2, 0xD9, 0xE0, 0x27, 0x38, 0xCE, 0x4F, 0x64, 0x41, 0x25, 0xEA, 0x08, 0xEE, 0xAE, 0x85,
+  0x07, 0x00, 0xB4, 0x40, 0xAF, 0x2F, 0x8C, 0x7E, 0xBB, 0xF2, 0x69, 0x08, 0x40, 0x98, 0xBF, 0x31,
+  0x46, 0xD5, 0xF6, 0xEE, 0x73, 0x13, 0x0C, 0x3E, 0xFB, 0x35, 0x30, 0x7F, 0x73, 0xA7, 0xB3, 0x7B,
+  0x94, 0x1E, 0xE8, 0x97, 0x52, 0xD9, 0x7A, 0x80, 0x40, 0xF0, 0x9D, 0x93, 0xEB, 0x25, 0x05, 0xF1,
+  0x6C, 0x08, 0x0C, 0xAC, 0x0A, 0x26, 0xD8, 0xF8, 0xE9, 0x28, 0x13, 0x78, 0x1C, 0x26, 0x73, 0x1B,
+  0x52, 0xFC, 0x40, 0xE3, 0xAD, 0x51, 0xDD, 0x81, 0x65, 0xF0, 0x52, 0xA3, 0xBA, 0x03, 0xEB, 0xE0,
+  0x02, 0xA9, 0x1E, 0xEA, 0xE0, 0xA5, 0xE3, 0x85, 0xB0, 0x16, 0x16, 0xC2, 0x69, 0x06, 0x1F, 0x2A,
+  0xC5, 0xE6, 0xBF, 0xBE, 0xDA, 0xFC, 0x95, 0x35, 0xDE, 0x35, 0xE5, 0x86, 0x6B, 0xBC, 0xB7, 0x65,
+  0x09, 0x6A, 0xBC, 0xB7, 0xE2, 0xEB, 0xAE, 0x12, 0xF1, 0x5C, 0xE3, 0xDD, 0x04, 0xA7, 0x81, 0xC6,
+  0xBB, 0xD5, 0xA4, 0x0E, 0x34, 0xDE, 0xF6, 0x55, 0x5C, 0x3D, 0xD8, 0x48, 0xEA, 0x1F, 0xD7, 0x78,
+  0xC7, 0xB7, 0xD0, 0x78, 0xEF, 0xFF, 0x45, 0xAA, 0x3B, 0x9A, 0x23, 0x5F, 0xA3, 0x49, 0x95, 0x77,
+  0x2C, 0xA8, 0xBC, 0x15, 0xAA, 0xBC, 0xA9, 0x8A, 0x6F, 0xA0, 0xF2, 0x8E, 0xE7, 0x2E, 0x4C, 0xAB,
+  0xBC, 0x53, 0xD9, 0x64, 0x42, 0x83, 0xCA, 0x9B, 0xC7, 0x9C, 0xE9, 0x63, 0xBB, 0x67, 0x12, 0x52,
+  0xF0, 0x78, 0x83, 0xE7, 0xD7, 0x0A, 0xC2, 0x8D, 0x95, 0xF4, 0x7E, 0x77, 0xEB, 0x28, 0xFA, 0x4A,
+  0x93, 0x94, 0x12, 0x45, 0x1C, 0x3E, 0x7D, 0x2D, 0x47, 0x1C, 0x3E, 0x7E, 0x2D, 0x46, 0x1C, 0x4E,
+  0x38, 0x29, 0x45, 0x1C, 0xD9, 0xFC, 0x75, 0x06, 0x55, 0xA3, 0xCA, 0x5B, 0x6F, 0xF5, 0x77, 0xAE,
+  0x94, 0xF0, 0xAA, 0x64, 0x57, 0xB6, 0x18, 0xD0, 0xA0, 0xED, 0xDE, 0x41, 0x66, 0x7F, 0x4B, 0xF0,
+  0x4D, 0xFA, 0xDE, 0x25, 0x09, 0xF6, 0x8C, 0xA0, 0xD5, 0xB6, 0x53, 0x4F, 0x3B, 0xE8, 0x71, 0x14,
+  0x52, 0x1D, 0x1F, 0xBF, 0xFE, 0xAC, 0x6C, 0xF6, 0xE3, 0x4F, 0x1E, 0x84, 0xCE, 0x77, 0x15, 0xEE,
+  0xCA, 0x9E, 0x02, 0x1A, 0x04, 0xDD, 0x2A, 0xDB, 0xEA, 0xEB, 0x53, 0xE1, 0xAE, 0x60, 0x26, 0xC0,
+  0x2D, 0x2D, 0xB4, 0x92, 0x98, 0x09, 0x58, 0xD8, 0x65, 0x99, 0xE1, 0xB6, 0x5E, 0xC2, 0x75, 0x1A,
+  0x1E, 0x59, 0x06, 0xA4, 0x76, 0x74, 0x9B, 0xD5, 0x68, 0x73, 0xBC, 0x44, 0xBB, 0x59, 0x8D, 0x3E,
+  0xC7, 0x0A, 0xF7, 0xF9, 0xE0, 0x73, 0xBC, 0x74, 0xB0, 0xCF, 0x2F, 0x18, 0x1D, 0x97, 0x0A, 0x4D,
+  0x3F, 0x83, 0x86, 0xC7, 0x31, 0x0D, 0x8F, 0x2D, 0x77, 0xD9, 0x2A, 0xF8, 0x95, 0xFD, 0x04, 0x34,
+  0x88, 0xB9, 0x73, 0x63, 0x15, 0x2D, 0xB0, 0x9B, 0x9D, 0x05, 0x7E, 0x89, 0xA1, 0xCF, 0x41, 0xDC,
+  0x33, 0xA2, 0xD3, 0x93, 0xCD, 0x81, 0x93, 0xAE, 0x81, 0xAF, 0xBB, 0xE3, 0xE4, 0xE2, 0xF6, 0x04,
+  0x27, 0x2E, 0x1F, 0xE3, 0x3C, 0xBB, 0xA5, 0xCE, 0xB7, 0xFD, 0xDD, 0x2A, 0x06, 0x3D, 0x70, 0x53,
+  0xC9, 0x0D, 0x3E, 0x5B, 0xE8, 0xF1, 0x13, 0xA3, 0x08, 0x99, 0x76, 0xC5, 0x3D, 0xFE, 0x1C, 0x2D,
+  0x36, 0xC5, 0x86, 0xFE, 0x23, 0x81, 0x8F, 0xCA, 0x36, 0x02, 0xBA, 0xA4, 0xDF, 0xDE, 0xD7, 0xD3,
+  0x67, 0xA6, 0x8C, 0x9B, 0xF5, 0x37, 0x22, 0x54, 0x97, 0x86, 0x24, 0x33, 0xD6, 0x83, 0x91, 0x67,
+  0x47, 0x07, 0xFD, 0x3F, 0xA9, 0x8F, 0x4F, 0x91, 0x6F, 0xF2, 0x16, 0xEE, 0xEE, 0x66, 0x04, 0x79,
+  0x65, 0xE7, 0x00, 0x0D, 0x8A, 0x6D, 0x6E, 0xAB, 0x38, 0x3D, 0x59, 0x78, 0x33, 0x8B, 0x6D, 0xB4,
+  0x91, 0x92, 0xE4, 0x5C, 0x23, 0x91, 0x6C, 0xEF, 0x36, 0x98, 0x1D, 0x18, 0xBC, 0x83, 0x9E, 0xA7,
+  0xEC, 0xA5, 0x08, 0xE7, 0x24, 0x17, 0xBD, 0x14, 0xF9, 0x70, 0xA1, 0xE8, 0xA5, 0xC8, 0x87, 0x0B,
+  0x25, 0x2F, 0x45, 0xD1, 0x70, 0x61, 0x86, 0x94, 0x8B, 0x1E, 0xDB, 0x23, 0x29, 0x57, 0x97, 0x0D,
+  0x03, 0x34, 0x28, 0xB6, 0x29, 0x1B, 0x6C, 0x59, 0x41, 0x99, 0x3B, 0x13, 0xFC, 0xA6, 0x8F, 0x48,
+  0xD6, 0x12, 0x27, 0xCF, 0x23, 0xE6, 0x5C, 0x98, 0xEA, 0xB7, 0x73, 0x26, 0x0E, 0x3D, 0xA8, 0x72,
+  0x09, 0xCD, 0x7B, 0x90, 0x64, 0x4C, 0x38, 0xD7, 0x02, 0x92, 0xF1, 0xD2, 0xC2, 0x5C, 0x4B, 0xC8,
+  0x32, 0x36, 0xC7, 0x4F, 0xBA, 0xC2, 0xF3, 0x91, 0x75, 0x53, 0xE3, 0x96, 0xA1, 0x17, 0xF8, 0x5C,
+  0x61, 0x98, 0x72, 0xDD, 0xA9, 0x4E, 0x53, 0x89, 0x6C, 0xB7, 0x67, 0xB0, 0xC3, 0x22, 0x3A, 0x4E,
+  0xC5, 0x08, 0x3A, 0xBA, 0xBB, 0x47, 0x0A, 0x03, 0xEC, 0x19, 0xD8, 0xEF, 0x15, 0x1C, 0xDE, 0x15,
+  0xA6, 0xDD, 0x82, 0xC5, 0xBB, 0x82, 0xB4, 0xAB, 0x31, 0xEB, 0x3A, 0xC8, 0xBA, 0x06, 0xF6, 0x7B,
+  0x4E, 0x96, 0x75, 0xE7, 0x38, 0x9B, 0x56, 0xB3, 0x52, 0x43, 0x8D, 0x75, 0x58, 0x74, 0xD9, 0x2E,
+  0x40, 0x83, 0x6E, 0x3B, 0x17, 0xD0, 0x06, 0x81, 0x6E, 0x7B, 0x2E, 0x25, 0x23, 0x97, 0xD0, 0xE2,
+  0xA1, 0x79, 0x92, 0x91, 0xAA, 0x11, 0xF0, 0x8B, 0xA5, 0x6C, 0x26, 0x14, 0x32, 0x16, 0x24, 0xB4,
+  0x5C, 0xBA, 0x5D, 0x94, 0xD0, 0x72, 0xE5, 0x76, 0x41, 0x42, 0x1B, 0x40, 0xB9, 0x5D, 0x92, 0xD0,
+  0x8A, 0x94, 0xDB, 0x73, 0x14, 0xB9, 0x9E, 0x4D, 0xF3, 0xFD, 0x58, 0xC6, 0x35, 0x65, 0xC7, 0x00,
+  0x0D, 0xD2, 0x6D, 0x9B, 0xF5, 0xF6, 0xD2, 0x09, 0x45, 0x3D, 0x91, 0x21, 0x0F, 0x46, 0xA9, 0xFA,
+  0x58, 0xB5, 0xC6, 0x84, 0x92, 0x71, 0x40, 0x25, 0x81, 0x73, 0x42, 0x09, 0xF5, 0x15, 0x06, 0x72,
+  0x2E, 0x1B, 0xAE, 0x76, 0x8B, 0x18, 0x95, 0x04, 0xFA, 0x7B, 0x09, 0x52, 0x6E, 0xEE, 0x9B, 0x32,
+  0x68, 0x27, 0x4E, 0x76, 0x58, 0x66, 0xA8, 0x73, 0x7D, 0x6E, 0x57, 0x51, 0x5B, 0x30, 0x8F, 0x80,
+  0xAF, 0xEC, 0x1B, 0xA0, 0x41, 0xC0, 0xED, 0x86, 0xCE, 0xD9, 0x96, 0x04, 0x07, 0xE7, 0xCD, 0x4E,
+  0x6E, 0x0F, 0x4C, 0x5C, 0x46, 0x68, 0x99, 0x47, 0xB2, 0x5E, 0x9F, 0x3A, 0x98, 0x54, 0xB2, 0x63,
+  0xF3, 0xA7, 0xF1, 0x5C, 0x0B, 0x9F, 0x87, 0xBC, 0xED, 0xA2, 0x1C, 0x87, 0x8C, 0x48, 0xBC, 0x7D,
+  0x06, 0xFC, 0x68, 0x1F, 0xEE, 0x97, 0x87, 0x0C, 0x77, 0x25, 0xF3, 0xCB, 0x9B, 0x63, 0xA4, 0x4A,
+  0xCC, 0x36, 0x25, 0x94, 0x95, 0x8D, 0x15, 0x0E, 0xCB, 0x46, 0x02, 0x1A, 0xD4, 0xDC, 0x5C, 0x52,
+  0x3B, 0x1D, 0x04, 0xDF, 0x40, 0x64, 0x31, 0x41, 0x6D, 0x12, 0xE9, 0xBA, 0x1D, 0xA0, 0xB0, 0xD0,
+  0x71, 0xDE, 0x6D, 0xDC, 0x38, 0x70, 0x2C, 0xC3, 0xD3, 0x1C, 0x0B, 0xE2, 0x5A, 0x14, 0x39, 0x16,
+  0xC4, 0xB5, 0x28, 0x72, 0x2C, 0x88, 0x6B, 0x41, 0xE4, 0x88, 0xE2, 0x5A, 0x51, 0x2C, 0x8C, 0x27,
+  0xA3, 0x35, 0x55, 0x75, 0x6F, 0xD9, 0x50, 0x40, 0x83, 0xAA, 0x3B, 0x64, 0xF4, 0x76, 0xFB, 0x33,
+  0x84, 0x42, 0x9F, 0xCF, 0xDB, 0x48, 0x81, 0xC4, 0x9B, 0x92, 0xAC, 0x08, 0x3E, 0xD0, 0x4F, 0xA5,
+  0xCF, 0xC7, 0x11, 0xF5, 0x8E, 0x40, 0x6D, 0xC7, 0x53, 0x55, 0x2C, 0x74, 0x5F, 0x0C, 0x1E, 0xAA,
+  0x12, 0x90, 0xDA, 0x0E, 0x87, 0xAA, 0x10, 0x6F, 0xBE, 0x18, 0xE1, 0x99, 0x2A, 0xE6, 0xF8, 0xE3,
+  0xB6, 0xE6, 0x16, 0x66, 0x15, 0xF0, 0x48, 0x14, 0xB4, 0x65, 0x63, 0x01, 0x0D, 0xFA, 0xEE, 0x90,
+  0x31, 0xDB, 0x9D, 0x40, 0x66, 0xFB, 0x06, 0x72, 0xC7, 0xBC, 0x1A, 0xB6, 0x98, 0x8D, 0x85, 0x5D,
+  0xC0, 0xC3, 0xEA, 0x91, 0x81, 0xCA, 0x87, 0x93, 0x0D, 0x2C, 0x10, 0xDB, 0xAD, 0x82, 0x06, 0xA0,
+  0x05, 0x62, 0x7B, 0xBB, 0x88, 0x21, 0x10, 0x88, 0xED, 0x0E, 0x15, 0xB7, 0x3C, 0x11, 0x5B, 0x59,
+  0xFB, 0x6F, 0x86, 0xEE, 0x33, 0x99, 0x1C, 0x82, 0x35, 0xE9, 0x61, 0x04, 0x82, 0x65, 0x8B, 0x01,
+  0x5D, 0x50, 0x7A, 0x87, 0x0C, 0x82, 0xD3, 0x75, 0xF0, 0x1B, 0x6C, 0x08, 0xA7, 0x28, 0x2F, 0xA2,
+  0xFD, 0xA0, 0x24, 0x13, 0xEF, 0xEC, 0xC6, 0xF4, 0x4D, 0x68, 0xCD, 0x05, 0xB7, 0x16, 0x6C, 0x6B,
+  0x2D, 0x9A, 0x99, 0x59, 0x70, 0xAD, 0xB5, 0xE8, 0x65, 0x16, 0x80, 0xED, 0x62, 0xC1, 0xCB, 0x8C,
+  0x78, 0x41, 0x6C, 0x84, 0x56, 0x66, 0x76, 0x86, 0x82, 0x58, 0x4C, 0x76, 0x71, 0x65, 0xB3, 0x01,
+  0x0D, 0xA2, 0x6F, 0x0E, 0xC1, 0xE9, 0x3E, 0xE0, 0x51, 0x49, 0x69, 0x43, 0xE0, 0x11, 0x03, 0x1E,
+  0xDF, 0x02, 0x1A, 0xF3, 0x26, 0x3D, 0xE8, 0x3E, 0xFD, 0x1A, 0x6E, 0xDF, 0x58, 0x44, 0x1E, 0x6F,
+  0x03, 0x16, 0x91, 0xC7, 0xBB, 0x80, 0x45, 0xE4, 0xC5, 0x69, 0xE4, 0x89, 0x9A, 0x80, 0x7E, 0x86,
+  0x26, 0xA0, 0x62, 0xB3, 0xB7, 0x30, 0xB6, 0x05, 0x74, 0x65, 0xBB, 0x01, 0x0D, 0x52, 0xEF, 0x98,
+  0x6D, 0x01, 0xBD, 0x60, 0x0B, 0x38, 0x13, 0xF2, 0x5C, 0x3E, 0xFC, 0x88, 0x90, 0x74, 0x8D, 0x52,
+  0x02, 0xE0, 0x59, 0xF0, 0x0D, 0xDD, 0x2F, 0xE4, 0xD9, 0x1E, 0x78, 0x70, 0xB4, 0xAD, 0x83, 0x7D,
+  0x9F, 0x25, 0xD8, 0xF7, 0x39, 0xD8, 0xF7, 0x59, 0x82, 0x7D, 0x5F, 0xC4, 0x7D, 0x9F, 0xE7, 0xFB,
+  0x3E, 0x38, 0x60, 0xB4, 0x75, 0x78, 0x3C, 0x85, 0x8D, 0x5E, 0xCC, 0x4F, 0x6E, 0xA9, 0xFB, 0xFC,
+  0x65, 0xD8, 0xF9, 0xB2, 0xC3, 0x80, 0x06, 0x7D, 0x77, 0xC8, 0xF4, 0xDD, 0x4E, 0x40, 0x73, 0x99,
+  0x8D, 0xCE, 0x8E, 0x4E, 0xC9, 0x3C, 0xD7, 0x06, 0x89, 0x96, 0x4C, 0xD4, 0x03, 0xDC, 0xCD, 0xB3,
+  0x1A, 0xF4, 0x00, 0xC1, 0x2B, 0x19, 0x4F, 0x2B, 0x30, 0x09, 0xB8, 0x2E, 0x78, 0x58, 0x41, 0xBB,
+  0x88, 0x05, 0x3D, 0x90, 0x75, 0xE7, 0xF3, 0xDD, 0x26, 0xE8, 0x71, 0x59, 0xB7, 0x95, 0x79, 0x4A,
+  0x85, 0x59, 0xCE, 0xF4, 0xCE, 0xCF, 0x0D, 0xA2, 0x31, 0xAA, 0x8B, 0x2F, 0xBB, 0x0B, 0xE8, 0x82,
+  0xAC, 0x3B, 0x64, 0x75, 0xEF, 0x09, 0xD1, 0x27, 0x20, 0x37, 0x8B, 0xFC, 0x7D, 0x0E, 0xDD, 0xEA,
+  0xED, 0x32, 0xAE, 0xC5, 0x13, 0x0A, 0x4C, 0x04, 0xEC, 0xE1, 0x01, 0x05, 0xED, 0x22, 0xD6, 0x72,
+  0x81, 0x84, 0x6B, 0xD1, 0xCF, 0x8C, 0x27, 0x5C, 0x23, 0x63, 0x59, 0x9D, 0x72, 0xA7, 0xE7, 0xCB,
+  0x8E, 0x02, 0x1A, 0x94, 0xDC, 0xDC, 0xD8, 0xE2, 0x84, 0x4A, 0xB2, 0xC4, 0xBA, 0xCE, 0x0E, 0x99,
+  0x56, 0xA2, 0xB9, 0x9B, 0xA8, 0xEB, 0x2C, 0x6D, 0xB6, 0x10, 0x1A, 0xFB, 0x40, 0xE0, 0xEB, 0x4E,
+  0x98, 0xD9, 0xE5, 0x67, 0x11, 0x41, 0x46, 0x56, 0xF4, 0xB3, 0xB0, 0x1C, 0x7C, 0xE8, 0x67, 0x21,
+  0x52, 0x91, 0xF9, 0x19, 0x7C, 0x04, 0x2C, 0x53, 0x91, 0xE9, 0xB1, 0xC1, 0x5B, 0x28, 0xFB, 0x08,
+  0x68, 0xD0, 0x70, 0xBB, 0x0C, 0x7D, 0x24, 0x38, 0xAC, 0xEA, 0xD7, 0x97, 0xBB, 0xBB, 0xBD, 0x19,
+  0x7E, 0x86, 0xCF, 0xDD, 0x14, 0xCB, 0xB8, 0x39, 0xCF, 0xA5, 0x0B, 0x1D, 0x03, 0xE0, 0x49, 0xC6,
+  0x6E, 0x87, 0xEE, 0xF5, 0x06, 0x1E, 0x8E, 0x90, 0x6F, 0x51, 0xCD, 0x61, 0x7C, 0xBE, 0xB3, 0xDB,
+  0x2E, 0xE2, 0xB3, 0x0E, 0x7E, 0x46, 0x95, 0x43, 0xD8, 0xE5, 0x5E, 0xA1, 0x57, 0xDB, 0x83, 0x5B,
+  0xD8, 0xAC, 0x43, 0x74, 0x44, 0x55, 0x9C, 0xC5, 0xBF, 0x22, 0x32, 0xAA, 0xC1, 0x48, 0xC2, 0x0D,
+  0x65, 0xEF, 0x00, 0x0D, 0xF2, 0x6D, 0xEE, 0x5C, 0xAB, 0x4E, 0x84, 0xBB, 0xA9, 0x33, 0x31, 0x8C,
+  0x96, 0xE4, 0xDA, 0x43, 0x8B, 0xDB, 0xE1, 0x71, 0x40, 0x38, 0xEB, 0x2D, 0xB8, 0xD6, 0x72, 0xDD,
+  0x76, 0xD1, 0xB5, 0x96, 0xCB, 0xB6, 0x8B, 0xAE, 0xB5, 0x8A, 0xE1, 0xAE, 0xE4, 0x5A, 0x2B, 0xF2,
+  0x4D, 0xB1, 0xB3, 0x1C, 0x1D, 0x2F, 0x3A, 0x11, 0xA3, 0xC2, 0x5D, 0xD9, 0x36, 0x40, 0x83, 0x6E,
+  0x7B, 0x07, 0xC5, 0xE5, 0xA4, 0xF1, 0x0E, 0x6C, 0x6B, 0x45, 0x9E, 0x01, 0x16, 0x66, 0x1A, 0x85,
+  0xC1, 0x9A, 0xD9, 0x49, 0x2B, 0x1D, 0x1C, 0xCC, 0x07, 0x9E, 0x01, 0x7F, 0x14, 0x8E, 0xCB, 0x1C,
+  0x5D, 0x65, 0xCD, 0x38, 0x2E, 0x6A, 0xAC, 0xC2, 0x8D, 0x65, 0xCB, 0x00, 0x0D, 0x82, 0x6D, 0xCA,
+  0x74, 0x44, 0xD9, 0x6C, 0xED, 0x0D, 0xA1, 0x97, 0x58, 0xC8, 0xEB, 0x8F, 0xC9, 0xE8, 0x18, 0x2E,
+  0x41, 0xC2, 0xEC, 0xB3, 0x20, 0x60, 0x2B, 0x40, 0x6F, 0xB7, 0x78, 0xB2, 0x47, 0x5E, 0x04, 0x66,
+  0x1F, 0x46, 0x3D, 0x8D, 0x13, 0xB5, 0x25, 0x86, 0x3D, 0x8D, 0x23, 0x35, 0x42, 0x11, 0x11, 0x8C,
+  0xD4, 0x96, 0x16, 0xC2, 0x9E, 0x70, 0xA6, 0x36, 0xCF, 0x36, 0x2F, 0x9F, 0x68, 0x54, 0xFB, 0xE9,
+  0xEF, 0xFF, 0xAE, 0xFE, 0x7C, 0xFF, 0x1F, 0x33, 0x1B, 0xBE, 0x00, 0x1A, 0xBC, 0x00, 0x00
+};
@@ -0,0 +1,150 @@
+// Parallel bulk ingest of recorded responses into an APW_History store, host only
+
+// Each worker thread parses whole response files with its own Apixu_Weather instance
+// through the compact replay, the same field extraction as the ApixuWeather_History
+// example. The files are dealt out to a queue per worker, and a worker that has
+// emptied its own queue takes files from the back of the others, so a few large or
+// slow files do not leave the other workers idle. The days are then added to the
+// store in date order on one thread, as APW_History only appends.
+
+// The workers read into malloc() buffers and the compact parse does not use the heap,
+// so the shim heap counters are only changed by the main thread.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef ingest_h
+#define ingest_h
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <APW_History.h>
+
+typedef struct {
+  uint32_t files   = 0; // Files read
+  uint32_t added   = 0; // Days added to the store
+  uint32_t failed  = 0; // Files that could not be read or parsed
+  uint32_t skipped = 0; // Days not after the last stored day, e.g. a repeated date
+  uint32_t stolen  = 0; // Files a worker took from another worker's queue
+  uint32_t parse_us = 0;
+  uint32_t add_us   = 0;
+} ingest_result;
+
+class Ingest {
+
+  public:
+    // Parse the files with threads workers and add the first day of each to history
+    static ingest_result run(APW_History &history, const std::vector<std::string> &paths,
+                             unsigned threads)
+    {
+      Ingest pool(paths, threads ? threads : 1);
+      ingest_result result;
+      result.files = paths.size();
+
+      uint32_t dt = micros();
+      std::vector<std::thread> workers;
+      for (unsigned w = 1; w < pool.threads; w++) workers.emplace_back(&Ingest::work, &pool, w);
+      pool.work(0);
+      for (std::thread &t : workers) t.join();
+      result.parse_us = micros() - dt;
+
+      dt = micros();
+      std::vector<APW_day_compact> days;
+      for (size_t i = 0; i < paths.size(); i++)
+        if (pool.parsed[i]) days.push_back(pool.day[i]); else result.failed++;
+
+      std::stable_sort(days.begin(), days.end(),
+        [](const APW_day_compact &a, const APW_day_compact &b) { return a.date_epoch < b.date_epoch; });
+
+      for (const APW_day_compact &d : days) if (history.add(d)) result.added++; else result.skipped++;
+      result.add_us = micros() - dt;
+      result.stolen = pool.stolen;
+
+      return result;
+    }
+
+  private:
+    Ingest(const std::vector<std::string> &paths, unsigned threads)
+      : paths(paths), threads(threads), queue(threads), lock(threads), weather(threads),
+        day(paths.size()), parsed(paths.size(), 0)
+    {
+      for (size_t i = 0; i < paths.size(); i++) queue[i % threads].push_back(i);
+    }
+
+    // Parse files until every queue is empty
+    void work(unsigned w)
+    {
+      char  *buffer = nullptr;
+      size_t size   = 0;
+      size_t index;
+
+      while (next(w, index))
+      {
+        FILE *file = fopen(paths[index].c_str(), "rb");
+        if (!file) continue;
+
+        fseek(file, 0, SEEK_END);
+        size_t length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        if (length + 1 > size)
+        {
+          char *grown = (char *)realloc(buffer, length + 1);
+          if (!grown) { fclose(file); continue; }
+          buffer = grown;
+          size = length + 1;
+        }
+        length = fread(buffer, 1, length, file);
+        buffer[length] = 0;
+        fclose(file);
+
+        APW_current_compact current;
+        APW_forecast_compact<1> forecast;
+        parsed[index] = weather[w].replayForecast(&current, &forecast, buffer) &&
+                        forecast.day[0].date_epoch;
+        day[index] = forecast.day[0];
+      }
+
+      free(buffer);
+    }
+
+    // Take the next file from the worker's own queue, or the last file of another
+    bool next(unsigned w, size_t &index)
+    {
+      {
+        std::lock_guard<std::mutex> guard(lock[w]);
+        if (!queue[w].empty()) { index = queue[w].front(); queue[w].pop_front(); return true; }
+      }
+
+      for (unsigned i = 1; i < threads; i++)
+      {
+        unsigned victim = (w + i) % threads;
+        std::lock_guard<std::mutex> guard(lock[victim]);
+        if (queue[victim].empty()) continue;
+        index = queue[victim].back();
+        queue[victim].pop_back();
+        stolen++;
+        return true;
+      }
+
+      return false;
+    }
+
+    const std::vector<std::string> &paths;
+    const unsigned threads;
+
+    std::vector<std::deque<size_t>> queue;   // Files waiting, one queue per worker
+    std::vector<std::mutex>         lock;    // Guards the queue of the same index
+    std::vector<Apixu_Weather>      weather; // Parser per worker
+    std::vector<APW_day_compact>    day;     // First day of each file
+    std::vector<uint8_t>            parsed;  // 1 if the file gave a day
+    std::atomic<uint32_t>           stolen { 0 };
+};
+
+#endif
@@ -0,0 +1,122 @@
+// Minimal Arduino core for building and testing the ApixuWeather library on a host
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <cstddef>
+#include <new>
+#include <chrono>
+#include <thread>
+
+#include "Arduino.h"
+#include "WiFi.h"
+
+HardwareSerial Serial;
+EspClass       ESP;
+WiFiClass      WiFi;
+
+ShimHeap shimHeap = { 0, 0, 0 };
+
+/***************************************************************************************
+** Function name:           millis, micros, delay, shimAdvance
+** Description:             Host clock
+***************************************************************************************/
+static unsigned long advanced = 0; // Microseconds added by shimAdvance()
+
+unsigned long micros(void)
+{
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return duration_cast<microseconds>(steady_clock::now() - start).count() + advanced;
+}
+
+unsigned long millis(void)
+{
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void shimAdvance(unsigned long ms)
+{
+  advanced += ms * 1000;
+}
+
+/***************************************************************************************
+** Function name:           operator new, operator delete
+** Description:             Count the heap, the block size is kept ahead of the block
+***************************************************************************************/
+// The counters are not atomic, heap use is only measured on one thread at a time
+static const size_t HEADER = alignof(std::max_align_t);
+
+void *operator new(size_t size)
+{
+  uint8_t *block = (uint8_t *)malloc(size + HEADER);
+  if (!block) throw std::bad_alloc();
+
+  *(size_t *)block = size;
+  shimHeap.allocations++;
+  shimHeap.used += size;
+  if (shimHeap.used > shimHeap.peak) shimHeap.peak = shimHeap.used;
+
+  return block + HEADER;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  try { return operator new(size); }
+  catch (...) { return nullptr; }
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  return operator new(size, std::nothrow);
+}
+
+void operator delete(void *p) noexcept
+{
+  if (!p) return;
+
+  uint8_t *block = (uint8_t *)p - HEADER;
+  shimHeap.used -= *(size_t *)block;
+  free(block);
+}
+
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t) noexcept { operator delete(p); }
+
+void shimHeapReset(void)
+{
+  shimHeap.allocations = 0;
+  shimHeap.peak = shimHeap.used;
+}
+
+/***************************************************************************************
+** Function name:           xTaskCreatePinnedToCore, vTaskDelay
+** Description:             FreeRTOS tasks on host threads
+***************************************************************************************/
+#ifdef ESP32
+int xTaskCreatePinnedToCore(void (*task)(void *), const char *name, uint32_t stack,
+                            void *param, unsigned priority, TaskHandle_t *handle, int core)
+{
+  std::thread(task, param).detach();
+  if (handle) *handle = (TaskHandle_t)1;
+  return pdPASS;
+}
+
+// Task delays run 100 times faster so the tests do not wait for the task timing
+void vTaskDelay(uint32_t ticks)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(ticks * portTICK_PERIOD_MS * 10));
+}
+#endif
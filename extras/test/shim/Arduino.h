@@ -0,0 +1,229 @@
+// Minimal Arduino core for building and testing the ApixuWeather library on a host
+
+// Only the parts of the Arduino API used by the library and the tests are provided.
+// String is a std::string, Serial writes to stdout, millis() and micros() are the host
+// clock and PROGMEM is ordinary memory. The heap is counted by operator new and delete
+// in Arduino.cpp, so ESP.getFreeHeap() and the library's heap statistics show the peak
+// heap used by a parse. std::string keeps short text in place, so fewer allocations
+// are counted than an Arduino String would make.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+#include <string>
+
+// Free heap reported when nothing is allocated, more than any test uses
+#ifndef SHIM_HEAP_SIZE
+  #define SHIM_HEAP_SIZE 1000000
+#endif
+
+/***************************************************************************************
+** Description:   Program memory, the host has only one address space
+***************************************************************************************/
+#define PROGMEM
+typedef const char *PGM_P;
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)(s))
+
+#define pgm_read_byte(p)  (*(const uint8_t *)(p))
+#define pgm_read_word(p)  (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+#define strcmp_P  strcmp
+#define strncmp_P strncmp
+
+/***************************************************************************************
+** Description:   Time
+***************************************************************************************/
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+
+// Move millis() and micros() on without waiting, for tests of timed code
+void shimAdvance(unsigned long ms);
+inline void yield(void) { }
+
+inline long random(long max) { return max > 0 ? rand() % max : 0; }
+
+/***************************************************************************************
+** Description:   String
+***************************************************************************************/
+class String {
+
+  public:
+    String() { }
+    String(const char *text) : s(text ? text : "") { }
+    String(const __FlashStringHelper *text) : s((const char *)text) { }
+    String(char c) : s(1, c) { }
+    String(int value) : s(std::to_string(value)) { }
+    String(unsigned int value) : s(std::to_string(value)) { }
+    String(long value) : s(std::to_string(value)) { }
+    String(unsigned long value) : s(std::to_string(value)) { }
+    String(float value, unsigned char decimals = 2) : s(fixed(value, decimals)) { }
+    String(double value, unsigned char decimals = 2) : s(fixed(value, decimals)) { }
+
+    unsigned int length(void) const { return s.size(); }
+    const char *c_str(void) const { return s.c_str(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+
+    bool equals(const String &other) const { return s == other.s; }
+    bool operator==(const String &other) const { return s == other.s; }
+    bool operator==(const char *other) const { return s == (other ? other : ""); }
+    bool operator!=(const String &other) const { return s != other.s; }
+    bool operator!=(const char *other) const { return !(*this == other); }
+
+    char operator[](unsigned int index) const { return index < s.size() ? s[index] : 0; }
+
+    String &operator+=(const String &other) { s += other.s; return *this; }
+    String &operator+=(const char *other) { if (other) s += other; return *this; }
+    String &operator+=(char c) { s += c; return *this; }
+
+    friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+    friend String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+    friend String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+    friend String operator+(const String &a, char b) { String r(a); r += b; return r; }
+
+    long  toInt(void) const { return atol(s.c_str()); }
+    float toFloat(void) const { return atof(s.c_str()); }
+
+  private:
+    static std::string fixed(double value, unsigned char decimals)
+    {
+      char text[32];
+      snprintf(text, sizeof(text), "%.*f", decimals, value);
+      return text;
+    }
+
+    std::string s;
+};
+
+/***************************************************************************************
+** Description:   Print and Stream
+***************************************************************************************/
+class Print {
+
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+      for (size_t i = 0; i < size; i++) write(buffer[i]);
+      return size;
+    }
+
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return print(String(s)); }
+    size_t print(const __FlashStringHelper *s) { return print(String(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int value) { return print(String(value)); }
+    size_t print(unsigned int value) { return print(String(value)); }
+    size_t print(long value) { return print(String(value)); }
+    size_t print(unsigned long value) { return print(String(value)); }
+    size_t print(double value, int decimals = 2) { return print(String(value, decimals)); }
+
+    size_t println(void) { return print('\n'); }
+    template <typename T> size_t println(T value) { size_t n = print(value); return n + println(); }
+
+    template <typename... T> size_t printf(const char *format, T... values)
+    {
+      char text[256];
+      snprintf(text, sizeof(text), format, values...);
+      return print(text);
+    }
+};
+
+class Stream : public Print {
+
+  public:
+    virtual int available(void) = 0;
+    virtual int read(void) = 0;
+    virtual int peek(void) = 0;
+    virtual void flush(void) { }
+
+    size_t readBytes(char *buffer, size_t length)
+    {
+      size_t count = 0;
+      while (count < length)
+      {
+        int c = read();
+        if (c < 0) break;
+        buffer[count++] = c;
+      }
+      return count;
+    }
+};
+
+class HardwareSerial : public Stream {
+
+  public:
+    void begin(unsigned long baud) { }
+    size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+    int available(void) { return 0; }
+    int read(void) { return -1; }
+    int peek(void) { return -1; }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+/***************************************************************************************
+** Description:   Network address and processor
+***************************************************************************************/
+class IPAddress {
+
+  public:
+    IPAddress() { }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t)d << 24) { }
+    operator uint32_t() const { return address; }
+
+  private:
+    uint32_t address = 0;
+};
+
+// Heap counters kept by operator new and delete
+typedef struct ShimHeap {
+  uint32_t allocations; // Blocks allocated since the counters were reset
+  uint32_t used;        // Bytes in use now
+  uint32_t peak;        // Most bytes in use since the counters were reset
+} ShimHeap;
+
+extern ShimHeap shimHeap;
+
+// Reset the allocation count and peak, e.g. before a parse
+void shimHeapReset(void);
+
+class EspClass {
+
+  public:
+    uint32_t getFreeHeap(void) { return SHIM_HEAP_SIZE - shimHeap.used; }
+    void deepSleep(uint64_t us) { }
+};
+
+extern EspClass ESP;
+
+/***************************************************************************************
+** Description:   FreeRTOS task calls used on the ESP32, run on host threads
+***************************************************************************************/
+#ifdef ESP32
+  typedef void *TaskHandle_t;
+  #define pdPASS 1
+  #define portTICK_PERIOD_MS 1
+
+  int xTaskCreatePinnedToCore(void (*task)(void *), const char *name, uint32_t stack,
+                              void *param, unsigned priority, TaskHandle_t *handle, int core);
+  void vTaskDelay(uint32_t ticks);
+#endif
+
+#endif
@@ -0,0 +1,29 @@
+// Arduino Client interface for host builds of the ApixuWeather library
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef Client_h
+#define Client_h
+
+#include "Arduino.h"
+
+class Client : public Stream {
+
+  public:
+    virtual int connect(IPAddress ip, uint16_t port) = 0;
+    virtual int connect(const char *host, uint16_t port) = 0;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+    virtual int available(void) = 0;
+    virtual int read(void) = 0;
+    virtual int read(uint8_t *buffer, size_t size) = 0;
+    virtual int peek(void) = 0;
+    virtual void flush(void) = 0;
+    virtual void stop(void) = 0;
+    virtual uint8_t connected(void) = 0;
+    virtual operator bool() = 0;
+};
+
+#endif
@@ -0,0 +1,3 @@
+// WiFi stand-in for host builds of the ApixuWeather library, see WiFi.h
+
+#include "WiFi.h"
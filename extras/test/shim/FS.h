@@ -0,0 +1,78 @@
+// File system stand-in for host builds of the ApixuWeather library
+
+// fs::FS and File on stdio, the paths are below a root directory given to the
+// constructor, e.g. fs::FS history("/tmp/history").
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef FS_h
+#define FS_h
+
+#include <sys/stat.h>
+
+#include <memory>
+
+#include "Arduino.h"
+
+namespace fs {
+
+class File : public Stream {
+
+  public:
+    File() { }
+    File(FILE *file) : file(file, [](FILE *f) { if (f) fclose(f); }) { }
+
+    explicit operator bool() const { return (bool)file; }
+
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, file.get()); }
+    size_t write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, file.get()); }
+    size_t read(uint8_t *buffer, size_t size) { return fread(buffer, 1, size, file.get()); }
+    int read(void) { int c = fgetc(file.get()); return c == EOF ? -1 : c; }
+    int peek(void) { int c = fgetc(file.get()); if (c != EOF) ungetc(c, file.get()); return c == EOF ? -1 : c; }
+    int available(void) { return size() - ftell(file.get()); }
+    bool seek(uint32_t position) { return fseek(file.get(), position, SEEK_SET) == 0; }
+    void close(void) { file.reset(); }
+
+    size_t size(void)
+    {
+      long position = ftell(file.get());
+      fseek(file.get(), 0, SEEK_END);
+      long end = ftell(file.get());
+      fseek(file.get(), position, SEEK_SET);
+      return end;
+    }
+
+  private:
+    std::shared_ptr<FILE> file;
+};
+
+class FS {
+
+  public:
+    FS(const char *root) : root(root) { }
+
+    File open(const String &path, const char *mode)
+    {
+      std::string m = std::string(mode) + "b";
+      return File(fopen((root + path.c_str()).c_str(), m.c_str()));
+    }
+
+    bool exists(const String &path)
+    {
+      struct stat st;
+      return stat((root + path.c_str()).c_str(), &st) == 0;
+    }
+
+    bool remove(const String &path) { return ::remove((root + path.c_str()).c_str()) == 0; }
+
+  private:
+    std::string root;
+};
+
+} // namespace fs
+
+using fs::File;
+
+#endif
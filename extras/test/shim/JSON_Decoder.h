@@ -0,0 +1,137 @@
+// Host stand-in for the JSON_Decoder library https://github.com/Bodmer/JSON_Decoder
+
+// Makes the same listener calls in the same order as the library for the messages
+// sent by the Apixu server, one character at a time. String escapes are passed on
+// without the backslash and \u sequences are not decoded. Set JSON_DECODER_DIR when
+// running cmake to build the tests with the library itself instead.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef JSON_Decoder_h
+#define JSON_Decoder_h
+
+#include "JSON_Listener.h"
+
+#ifndef JSON_DEPTH
+  #define JSON_DEPTH 20 // Deepest nesting of objects and arrays
+#endif
+
+class JSON_Decoder {
+
+  public:
+    void setListener(JsonListener *listener) { this->listener = listener; }
+
+    void reset(void)
+    {
+      state  = START;
+      depth  = 0;
+      length = 0;
+      escape = false;
+    }
+
+    void parse(char c)
+    {
+      if (state == IN_STRING || state == IN_KEY) { parseString(c); return; }
+
+      if (state == IN_LITERAL)
+      {
+        if (c != ',' && c != '}' && c != ']' && !isSpace(c)) { add(c); return; }
+        text[length] = 0;
+        length = 0;
+        listener->value(text);
+        endValue();
+      }
+
+      if (isSpace(c)) { listener->whitespace(c); return; }
+
+      switch (state) {
+
+        case START:
+          if (c != '{' && c != '[') return;
+          listener->startDocument();
+          // Fall through to the start of the first value
+
+        case VALUE:
+          if (c == '{' || c == '[') open(c);
+          else if (c == '"') state = IN_STRING;
+          else if (c == ']' && depth && nest[depth - 1] == '[') close(c);
+          else { state = IN_LITERAL; add(c); }
+          return;
+
+        case KEY:
+          if (c == '"') state = IN_KEY;
+          else if (c == '}' && depth) close(c);
+          return;
+
+        case AFTER_KEY:
+          if (c == ':') state = VALUE;
+          else listener->error("colon expected");
+          return;
+
+        case AFTER_VALUE:
+          if (c == ',') state = (nest[depth - 1] == '{') ? KEY : VALUE;
+          else if ((c == '}' || c == ']') && nest[depth - 1] == (c == '}' ? '{' : '[')) close(c);
+          else listener->error("unexpected character");
+          return;
+
+        default: // DONE
+          return;
+      }
+    }
+
+  private:
+
+    enum : uint8_t { START, VALUE, KEY, AFTER_KEY, IN_STRING, IN_KEY, IN_LITERAL,
+                     AFTER_VALUE, DONE };
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    void add(char c) { if (length < sizeof(text) - 1) text[length++] = c; }
+
+    void parseString(char c)
+    {
+      if (escape) { add(c); escape = false; return; }
+      if (c == '\\') { escape = true; return; }
+      if (c != '"') { add(c); return; }
+
+      text[length] = 0;
+      length = 0;
+      if (state == IN_KEY) { listener->key(text); state = AFTER_KEY; }
+      else { listener->value(text); endValue(); }
+    }
+
+    void open(char c)
+    {
+      if (depth == JSON_DEPTH) { listener->error("nested too deep"); state = DONE; return; }
+      nest[depth++] = c;
+      if (c == '{') { listener->startObject(); state = KEY; }
+      else { listener->startArray(); state = VALUE; }
+    }
+
+    void close(char c)
+    {
+      depth--;
+      if (c == '}') listener->endObject();
+      else listener->endArray();
+      endValue();
+    }
+
+    void endValue(void)
+    {
+      if (depth) { state = AFTER_VALUE; return; }
+      state = DONE;
+      listener->endDocument();
+    }
+
+    JsonListener *listener = nullptr;
+    uint8_t  state  = START;
+    uint8_t  depth  = 0;
+    char     nest[JSON_DEPTH];
+    char     text[512];
+    uint16_t length = 0;
+    bool     escape = false;
+};
+
+#endif
@@ -0,0 +1,136 @@
+// WiFi stand-in for host builds of the ApixuWeather library, POSIX sockets
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#include "WiFi.h"
+
+/***************************************************************************************
+** Function name:           hostByName
+** Description:             Resolve a host name to an IPv4 address
+***************************************************************************************/
+int WiFiClass::hostByName(const char *host, IPAddress &ip)
+{
+  addrinfo hints = {}, *result = nullptr;
+  hints.ai_family   = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+
+  if (getaddrinfo(host, nullptr, &hints, &result) || !result) return 0;
+
+  const uint8_t *a = (const uint8_t *)&((sockaddr_in *)result->ai_addr)->sin_addr;
+  ip = IPAddress(a[0], a[1], a[2], a[3]);
+  freeaddrinfo(result);
+  return 1;
+}
+
+/***************************************************************************************
+** Function name:           connect
+** Description:             Open a TCP connection
+***************************************************************************************/
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+  stop();
+
+  fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return 0;
+
+  sockaddr_in address = {};
+  address.sin_family      = AF_INET;
+  address.sin_port        = htons(port);
+  address.sin_addr.s_addr = (uint32_t)ip; // IPAddress holds the bytes in network order
+
+  if (::connect(fd, (sockaddr *)&address, sizeof(address)) < 0) { stop(); return 0; }
+
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip)) return 0;
+  return connect(ip, port);
+}
+
+/***************************************************************************************
+** Function name:           write
+** Description:             Send all the bytes, waiting for the socket if it is full
+***************************************************************************************/
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+  size_t sent = 0;
+  while (fd >= 0 && sent < size)
+  {
+    ssize_t count = send(fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+    if (count > 0) sent += count;
+    else if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) delay(1);
+    else break;
+  }
+  return sent;
+}
+
+/***************************************************************************************
+** Function name:           available, read, peek
+** Description:             Received bytes, reads never wait
+***************************************************************************************/
+int WiFiClient::available(void)
+{
+  int count = 0;
+  if (fd < 0 || ioctl(fd, FIONREAD, &count) < 0) return 0;
+  return count;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+  if (fd < 0) return -1;
+  ssize_t count = recv(fd, buffer, size, MSG_DONTWAIT);
+  return count > 0 ? count : -1;
+}
+
+int WiFiClient::read(void)
+{
+  uint8_t c;
+  return (read(&c, 1) == 1) ? c : -1;
+}
+
+int WiFiClient::peek(void)
+{
+  uint8_t c;
+  if (fd < 0 || recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 1) return -1;
+  return c;
+}
+
+/***************************************************************************************
+** Function name:           stop, connected
+** Description:             Close the connection, check the server has not closed it
+***************************************************************************************/
+void WiFiClient::stop(void)
+{
+  if (fd >= 0) close(fd);
+  fd = -1;
+}
+
+uint8_t WiFiClient::connected(void)
+{
+  if (fd < 0) return 0;
+
+  // A peek of 0 bytes is the end of the stream, no data yet is still connected
+  uint8_t c;
+  ssize_t count = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (count > 0) return 1;
+  if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 1;
+  return 0;
+}
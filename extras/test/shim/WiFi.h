@@ -0,0 +1,68 @@
+// WiFi stand-in for host builds of the ApixuWeather library
+
+// WiFiClient is a TCP socket, so the library's default transport works on the host,
+// e.g. against a loopback server set with setServer(). The tests without a server give
+// the library an APW_ReplayClient with setClient() instead. Included as <WiFi.h> for
+// an ESP32 build and as <ESP8266WiFi.h> when ESP8266 is defined.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef WiFi_h
+#define WiFi_h
+
+#include "Arduino.h"
+#include "Client.h"
+
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WL_CONNECTED 3
+
+class WiFiClient : public Client {
+
+  public:
+    WiFiClient() { }
+    ~WiFiClient() { stop(); }
+
+    // One owner for the socket
+    WiFiClient(const WiFiClient &) = delete;
+    WiFiClient &operator=(const WiFiClient &) = delete;
+
+    // Connects blocking, then reads do not block
+    int connect(IPAddress ip, uint16_t port);
+    int connect(const char *host, uint16_t port);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size);
+    int available(void);
+    int read(void);
+    int read(uint8_t *buffer, size_t size);
+    int peek(void);
+    void flush(void) { }
+    void stop(void);
+
+    // Open until the server has closed and everything sent has been read
+    uint8_t connected(void);
+    operator bool() { return fd >= 0; }
+    void setNoDelay(bool noDelay) { }
+
+    using Print::write;
+
+  private:
+    int fd = -1; // Socket, -1 when closed
+};
+
+class WiFiClass {
+
+  public:
+    void mode(int mode) { }
+    void begin(const char *ssid, const char *password) { }
+    int status(void) { return WL_CONNECTED; }
+
+    // IPv4 address of a host name or dotted address
+    int hostByName(const char *host, IPAddress &ip);
+};
+
+extern WiFiClass WiFi;
+
+#endif
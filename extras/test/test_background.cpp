@@ -0,0 +1,56 @@
+// Check the values published by the background fetch task, ESP32 only
+
+// The task fetches the recorded message over a simulated link while the loop below
+// polls update(). The first set taken must hold the whole message with all the
+// changed bits set, and update() must never wait for the task.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+
+#include <APW_Background.h>
+#include <APW_ReplayClient.h>
+
+#define BACKGROUND_WAIT_MS 5000
+
+Apixu_Weather apw;
+APW_Background background(apw);
+APW_ReplayClient replayClient(forecast_json);
+
+int main()
+{
+  apw.setClient(&replayClient);
+  replayClient.setLink(5);
+
+  checkValue("begin", (uint32_t)background.begin("key", "New%20York"), 1);
+  checkValue("begin again", (uint32_t)background.begin("key", "New%20York"), 0);
+
+  uint32_t updates = 0, longest = 0;
+  uint32_t start = millis();
+
+  while (!updates && millis() - start < BACKGROUND_WAIT_MS)
+  {
+    uint32_t t = micros();
+    if (background.update()) updates++;
+    t = micros() - t;
+    if (t > longest) longest = t;
+  }
+
+  checkValue("updates", updates, 1);
+  checkValue("changed", (uint32_t)background.current()->changed, 0xFFFF);
+  checkGolden(apw, background.current(), background.forecast(), true);
+  checkText ("name", background.current()->name, "New York");
+
+  // The next fetch is not due for minutes, nothing new is published
+  delay(100);
+  checkValue("no update", (uint32_t)background.update(), 0);
+
+  Serial.print("longest update us  : "); Serial.println(longest);
+
+  // The task never returns, leave without waiting for it
+  int result = testResult("background");
+  fflush(stdout);
+  _Exit(result);
+}
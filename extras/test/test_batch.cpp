@@ -0,0 +1,106 @@
+// Fetch a batch of locations from a loopback stand-in server
+
+// Each location of a batch gets its own state and error, so one city the server
+// rejects fails alone and the others must still give the golden values. The wall time
+// of serial and batched fetches over a paced link is reported for 1 to BATCH_CITIES
+// locations, and the batch of all of them must beat the serial fetches.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+#include "test_server.h"
+#include <APW_Batch.h>
+
+#define BATCH_CITIES 6
+
+const char *city[BATCH_CITIES] = { "London", "Paris", "Nowhere", "Tokyo", "Sydney", "Cairo" };
+
+APW_Batch     batch;
+Apixu_Weather apw;
+
+APW_location location[BATCH_CITIES];
+
+// Wall time in ms to fetch the first count cities one after another
+uint32_t serial(uint8_t count)
+{
+  uint32_t dt = millis();
+  for (uint8_t i = 0; i < count; i++)
+    apw.getForecast(location[i].current, location[i].forecast, "key", location[i].city);
+  return millis() - dt;
+}
+
+// Wall time in ms to fetch the first count cities as a batch
+uint32_t batched(uint8_t count)
+{
+  uint32_t dt = millis();
+  batch.getForecastBatch(location, count, "key");
+  return millis() - dt;
+}
+
+int main()
+{
+  std::string body(forecast_json);
+  std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) +
+                         "\r\nConnection: close\r\n\r\n" + body;
+  std::string error = "HTTP/1.1 400 Bad Request\r\nContent-Length: 20\r\nConnection: close\r\n\r\n"
+                      "{\"error\":{\"code\":1}}";
+
+  for (uint8_t i = 0; i < BATCH_CITIES; i++)
+  {
+    location[i].city     = city[i];
+    location[i].current  = new APW_current;
+    location[i].forecast = new APW_forecast;
+  }
+
+  // One city fails, the others complete
+  {
+    TestServer server(response);
+    server.route("q=Nowhere", error);
+    batch.setServer("127.0.0.1", server.port());
+
+    checkValue("batch ok", (uint32_t)batch.getForecastBatch(location, BATCH_CITIES, "key"), 0);
+    checkValue("requests", server.requests, BATCH_CITIES);
+    checkValue("not busy", (uint32_t)batch.busy(), 0);
+
+    for (uint8_t i = 0; i < BATCH_CITIES; i++)
+    {
+      bool fails = !strcmp(city[i], "Nowhere");
+      checkValue(city[i], (uint32_t)location[i].state, (uint32_t)(fails ? APW_FAILED : APW_DONE));
+      checkValue(city[i], (uint32_t)location[i].error, (uint32_t)(fails ? APW_HTTP_ERROR : APW_NO_ERROR));
+      if (!fails) checkGolden(apw, location[i].current, location[i].forecast, true);
+    }
+  }
+
+  // Scaling over a link with latency and a limited rate, as to a remote server
+  location[2].city = "Berlin";
+  {
+    TestServer server(response);
+    server.setLink(100, 200000, 1460);
+    apw.setServer("127.0.0.1", server.port());
+    batch.setServer("127.0.0.1", server.port());
+
+    Serial.println("cities  serial ms  batch ms");
+
+    uint32_t serialTime = 0, batchTime = 0;
+    for (uint8_t count = 1; count <= BATCH_CITIES; count++)
+    {
+      serialTime = serial(count);
+      batchTime  = batched(count);
+      Serial.printf("%6u  %9lu  %8lu\n", count, (unsigned long)serialTime, (unsigned long)batchTime);
+    }
+
+    // BATCH_CONNECTIONS requests overlap, so the batch takes well under the serial time
+    if (batchTime * 2 > serialTime) checkValue("batch time", batchTime, serialTime / 2);
+    checkValue("all fetched", (uint32_t)batch.getForecastBatch(location, BATCH_CITIES, "key"), 1);
+  }
+
+  for (uint8_t i = 0; i < BATCH_CITIES; i++)
+  {
+    delete location[i].current;
+    delete location[i].forecast;
+  }
+
+  return testResult("batch");
+}
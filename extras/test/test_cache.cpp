@@ -0,0 +1,127 @@
+// Check the cache hits and the changed bits of cached reads
+
+// Each caller that keeps its structs must see only what changed since its own last
+// read, a hit with nothing new sets no bits and a refetch of the same values changes
+// nothing. Cached values must stay readable while a refetch runs and be kept when a
+// fetch fails or cannot start.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <string>
+
+#include "test_check.h"
+
+#include <APW_Cache.h>
+#include <APW_ReplayClient.h>
+
+Apixu_Weather apw;
+APW_Cache     cache(apw);
+
+void clearChanged(APW_current &current, APW_forecast &forecast)
+{
+  current.changed = 0;
+  for (uint8_t i = 0; i < MAX_DAYS; i++) forecast.changed[i] = 0;
+}
+
+int main()
+{
+  // The same message with a new temperature
+  std::string warmer(forecast_json);
+  warmer.replace(warmer.find("\"temp_c\":4.4"), 12, "\"temp_c\":9.9");
+
+  APW_ReplayClient recorded(forecast_json);
+  APW_ReplayClient changed(warmer.c_str());
+
+  APW_current  a, b;
+  APW_forecast fa, fb;
+
+  apw.setClient(&recorded);
+
+  cache.getForecast(&a, &fa, "key", "New%20York");
+  checkValue("first read", (uint32_t)a.changed, 0xFFFF);
+  checkGolden(apw, &a, &fa, true);
+  clearChanged(a, fa);
+
+  cache.getForecast(&a, &fa, "key", "New%20York");
+  checkValue("hits", cache.hits, 1);
+  checkValue("hit changed", (uint32_t)a.changed, 0);
+  checkValue("hit changed[0]", (uint32_t)fa.changed[0], 0);
+
+  cache.getForecast(&b, &fb, "key", "New%20York");
+  checkValue("second caller", (uint32_t)b.changed, 0xFFFF);
+  clearChanged(b, fb);
+
+  // Refetch the same values
+  cache.setTTL(0);
+  cache.getForecast(&a, &fa, "key", "New%20York");
+  checkValue("stale", cache.stale, 1);
+  checkValue("refetch changed", (uint32_t)a.changed, 0);
+  checkValue("refetch changed[0]", (uint32_t)fa.changed[0], 0);
+
+  // Refetch a new temperature, only that is flagged
+  apw.setClient(&changed);
+  cache.getForecast(&a, &fa, "key", "New%20York");
+  checkValue("new temp changed", (uint32_t)a.changed, APW_CUR_TEMP);
+  checkValue("new temp", a.temp, 9.9);
+
+  // The other caller sees the same change at its next read
+  cache.setTTL(CACHE_TTL);
+  cache.getForecast(&b, &fb, "key", "New%20York");
+  checkValue("other caller changed", (uint32_t)b.changed, APW_CUR_TEMP);
+  clearChanged(b, fb);
+
+  // A unit change flags the unit values
+  apw.setMetric(false);
+  cache.getForecast(&b, &fb, "key", "New%20York");
+  checkValue("units changed", (uint32_t)b.changed, APW_CUR_UNITS);
+  checkValue("units changed[0]", (uint32_t)fb.changed[0], APW_DAY_UNITS);
+
+  apw.setMetric(true);
+
+  APW_current  c;
+  APW_forecast fc;
+
+  // A refetch that cannot start, the instance is busy with a request of its own
+  APW_current  other;
+  APW_forecast otherForecast;
+  APW_ReplayClient slow(forecast_json);
+  slow.setLink(50);
+  apw.setClient(&slow);
+  apw.beginForecast(&other, &otherForecast, "key", "London");
+  cache.setTTL(0);
+  checkValue("busy", (uint32_t)cache.request("key", "New%20York"), (uint32_t)APW_FAILED);
+  checkValue("busy read", (uint32_t)cache.read("New%20York", &c, &fc), 1);
+  checkValue("busy temp", c.temp, 9.9);
+  while (apw.poll() < APW_DONE) yield();
+
+  // The values can be read during a refetch and are kept if it fails
+  APW_ReplayClient failing("HTTP/1.1 500 Internal Server Error\r\nContent-Length: 0\r\n\r\n");
+  apw.setClient(&failing);
+  checkValue("refetch started", (uint32_t)(cache.request("key", "New%20York") < APW_DONE), 1);
+  checkValue("refetch read", (uint32_t)cache.read("New%20York", &c, &fc), 1);
+  APW_state result;
+  while ((result = cache.poll()) < APW_DONE) yield();
+  checkValue("refetch failed", (uint32_t)result, (uint32_t)APW_FAILED);
+  checkValue("failed read", (uint32_t)cache.read("New%20York", &c, &fc), 1);
+  checkValue("failed temp", c.temp, 9.9);
+
+  // A new city that fails does not evict a cached city
+  cache.setTTL(CACHE_TTL);
+  apw.setClient(&recorded);
+  cache.getForecast(&c, &fc, "key", "London");
+  apw.setClient(&failing);
+  checkValue("new city", (uint32_t)cache.getForecast(&c, &fc, "key", "Paris"), 0);
+  checkValue("kept first", (uint32_t)cache.read("New%20York", &c, &fc), 1);
+  checkValue("kept second", (uint32_t)cache.read("London", &c, &fc), 1);
+
+  // Once it succeeds it replaces one of them
+  apw.setClient(&recorded);
+  checkValue("new city again", (uint32_t)cache.getForecast(&c, &fc, "key", "Paris"), 1);
+  checkValue("replaced", (uint32_t)(cache.read("New%20York", &c, &fc) + cache.read("London", &c, &fc)), 1);
+
+  apw.setClient(nullptr);
+
+  return testResult("cache");
+}
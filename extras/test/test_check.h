@@ -0,0 +1,101 @@
+// Checks shared by the host tests of the ApixuWeather library
+
+// Each test counts the mismatches with the expected values in failCount and returns
+// testResult() from main(), so ctest reports the test as failed if any check failed.
+// The golden values are those of the recorded message in forecast_sample.h.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef test_check_h
+#define test_check_h
+
+#include <Arduino.h>
+
+// Choose the WiFi library to load depending on the processor, as the sketches do
+#ifdef ESP8266
+  #include <ESP8266WiFi.h>
+#else // ESP32
+  #include <WiFi.h>
+#endif
+
+#include <JSON_Decoder.h>
+
+#include <ApixuWeather.h>
+
+#include "forecast_sample.h" // Recorded message and golden values
+
+static uint16_t failCount = 0; // Mismatch count
+
+/***************************************************************************************
+** Function name:           checkValue, checkText
+** Description:             Compare a value with the expected value
+***************************************************************************************/
+inline void checkValue(const char *name, float value, float golden)
+{
+  if (fabs(value - golden) < 0.001) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print(value); Serial.print(" expected "); Serial.println(golden);
+}
+
+inline void checkValue(const char *name, uint32_t value, uint32_t golden)
+{
+  if (value == golden) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print((unsigned long)value); Serial.print(" expected "); Serial.println((unsigned long)golden);
+}
+
+inline void checkText(const char *name, String value, const char *golden)
+{
+  if (value == golden) return;
+  failCount++;
+  Serial.print("mismatch "); Serial.print(name); Serial.print(" : ");
+  Serial.print(value); Serial.print(" expected "); Serial.println(golden);
+}
+
+/***************************************************************************************
+** Function name:           checkGolden
+** Description:             Check the extracted values against the golden values
+***************************************************************************************/
+inline void checkGolden(Apixu_Weather &apw, APW_current *current, APW_forecast *forecast, bool metric)
+{
+  uint8_t u = metric ? 0 : 1;
+
+  checkValue("temp",     current->temp,     golden_temp[u]);
+  checkValue("wind",     current->wind,     golden_wind[u]);
+  checkValue("pressure", current->pressure, golden_pressure[u]);
+  checkValue("precip",   current->precip,   golden_precip[u]);
+  checkText ("current condition", apw.conditionText(current->condition, current->is_day), "Partly cloudy");
+
+  for (int i = 0; i < MAX_DAYS && i < GOLDEN_DAYS; i++)
+  {
+    checkValue("date_epoch",  forecast->date_epoch[i],  golden_date_epoch[i]);
+    checkValue("maxtemp",     forecast->maxtemp[i],     golden_maxtemp[u][i]);
+    checkValue("mintemp",     forecast->mintemp[i],     golden_mintemp[u][i]);
+    checkValue("totalprecip", forecast->totalprecip[i], golden_totalprecip[u][i]);
+#ifndef TEXT_FROM_CODE
+    checkText ("text",        forecast->text[i],        golden_text[i]);
+#endif
+    checkText ("condition",   apw.conditionText(forecast->condition[i]), golden_text[i]);
+    checkText ("sunrise",     forecast->sunrise[i],     golden_sunrise[i]);
+    checkText ("moonset",     forecast->moonset[i],     golden_moonset[i]);
+  }
+}
+
+/***************************************************************************************
+** Function name:           testResult
+** Description:             Report the checks, the exit code for main()
+***************************************************************************************/
+inline int testResult(const char *name)
+{
+  Serial.print(name); Serial.print(" check : ");
+  if (failCount) { Serial.print(failCount); Serial.println(" FAILED"); }
+  else Serial.println("passed");
+
+  return failCount ? 1 : 0;
+}
+
+#endif
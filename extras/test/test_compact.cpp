@@ -0,0 +1,98 @@
+// Replay into the compact structures and the hourly store
+
+// The compact structures are fixed size with no heap use. The hourly arrays are only
+// parsed for the hourly store, and a request for fewer days than the message holds
+// stops once the days requested are stored.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+
+Apixu_Weather apw;
+
+APW_current_compact               compactCurrent;
+APW_forecast_compact<GOLDEN_DAYS> compactForecast;
+APW_forecast_compact<1>           firstDay;
+APW_hourly<GOLDEN_HOURS>          hourly;
+
+// Minutes since midnight to the "06:35 AM" format sent by the server
+String strMinutes(uint16_t minutes)
+{
+  if (minutes == APW_NO_TIME) return "";
+  char text[9];
+  uint8_t hours = (minutes / 60) % 12;
+  snprintf(text, sizeof(text), "%02d:%02d %s", hours ? hours : 12, minutes % 60, minutes < 720 ? "AM" : "PM");
+  return text;
+}
+
+int main()
+{
+  apw.setHourly(&hourly);
+  shimHeapReset();
+  bool ok = apw.replayForecast(&compactCurrent, &compactForecast, forecast_json);
+  uint32_t allocations = shimHeap.allocations;
+  apw.setHourly(nullptr);
+
+  checkValue("parse ok",    (uint32_t)ok, 1);
+  checkValue("allocations", allocations, 0);
+  checkValue("String stores", apw.getStats().stores, 0);
+
+  checkValue("temp",     APW_toFloat(compactCurrent.temp),     golden_temp[0]);
+  checkValue("wind",     APW_toFloat(compactCurrent.wind),     golden_wind[0]);
+  checkValue("pressure", APW_toFloat(compactCurrent.pressure), golden_pressure[0]);
+  checkValue("precip",   APW_toFloat(compactCurrent.precip),   golden_precip[0]);
+
+  for (int i = 0; i < GOLDEN_DAYS; i++)
+  {
+    APW_day_compact &day = compactForecast.day[i];
+    checkValue("date_epoch",  day.date_epoch,               golden_date_epoch[i]);
+    checkValue("maxtemp",     APW_toFloat(day.maxtemp),     golden_maxtemp[0][i]);
+    checkValue("mintemp",     APW_toFloat(day.mintemp),     golden_mintemp[0][i]);
+    checkValue("totalprecip", APW_toFloat(day.totalprecip), golden_totalprecip[0][i]);
+    checkText ("sunrise",     strMinutes(day.sunrise),      golden_sunrise[i]);
+    checkText ("moonset",     strMinutes(day.moonset),      golden_moonset[i]);
+  }
+
+  checkValue("hour count", (uint32_t)hourly.count(),                 (uint32_t)GOLDEN_HOURS);
+  checkValue("hour epoch", hourly[0].time_epoch,                     golden_hour_epoch[0]);
+  checkValue("hour temp",  APW_toFloat(hourly[0].temp),              golden_hour_temp[0]);
+  checkValue("hour wind",  (uint32_t)hourly[0].wind,                 (uint32_t)golden_hour_wind);
+  checkValue("hour rain",  (uint32_t)hourly[0].chance_of_rain,       (uint32_t)golden_hour_rain);
+  checkValue("hour epoch", hourly[GOLDEN_HOURS - 1].time_epoch,      golden_hour_epoch[1]);
+  checkValue("hour temp",  APW_toFloat(hourly[GOLDEN_HOURS - 1].temp), golden_hour_temp[1]);
+
+  // Current conditions and the hourly store without a forecast struct, the parse
+  // stops once the store is full
+  APW_current *current = new APW_current;
+  APW_hourly<GOLDEN_HOURS> hoursOnly;
+  apw.setHourly(&hoursOnly);
+  ok = apw.replayForecast(current, (APW_forecast *)nullptr, forecast_json);
+  apw.setHourly(nullptr);
+  checkValue("hourly only ok",    (uint32_t)ok, 1);
+  checkValue("hourly only count", (uint32_t)hoursOnly.count(), (uint32_t)GOLDEN_HOURS);
+  checkValue("hourly only temp",  APW_toFloat(hoursOnly[GOLDEN_HOURS - 1].temp), golden_hour_temp[1]);
+  checkValue("hourly only now",   current->temp, golden_temp[0]);
+  if (apw.getStats().bytes >= strlen(forecast_json))
+    checkValue("hourly only stop", apw.getStats().bytes, (uint32_t)strlen(forecast_json));
+  delete current;
+
+  // Without the hourly store the hourly arrays are passed over
+  apw.replayForecast(&compactCurrent, &compactForecast, forecast_json);
+  uint32_t skipped = apw.getStats().skipped;
+  if (!skipped) checkValue("skipped", skipped, 1);
+
+  // One day wanted, the parse stops before the second day
+  apw.replayForecast(&compactCurrent, &firstDay, forecast_json);
+  const char *second = strstr(forecast_json, "\"date\":\"2018-11-11\"");
+  if (apw.getStats().bytes > (uint32_t)(second - forecast_json))
+    checkValue("stopped at", apw.getStats().bytes, second - forecast_json);
+  checkValue("first day", firstDay.day[0].date_epoch, golden_date_epoch[0]);
+
+  Serial.print("structure bytes    : "); Serial.println(sizeof(compactCurrent) + sizeof(compactForecast));
+  Serial.print("hourly store bytes : "); Serial.println(sizeof(hourly));
+  Serial.print("skipped bytes      : "); Serial.println(skipped);
+
+  return testResult("compact");
+}
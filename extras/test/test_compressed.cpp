@@ -0,0 +1,60 @@
+// Replay a gzip compressed response through the request loop
+
+// The response is decoded as it is read. A compressed response without
+// setCompression(true) fails with APW_DECODE_ERROR. Built for the ESP8266 too, where
+// setCompression(true) refuses the smaller default window.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <APW_ReplayClient.h>
+
+#include "test_check.h"
+#include "forecast_gzip.h" // The recorded message as a gzip compressed HTTP response
+
+Apixu_Weather apw;
+
+// Returns the error of a request for the response
+uint32_t request(const char *response, uint32_t length, bool golden)
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  APW_ReplayClient client(response, length);
+  apw.setClient(&client);
+  apw.getForecast(current, forecast, "key", "New%20York");
+  apw.setClient(nullptr);
+
+  if (golden) checkGolden(apw, current, forecast, true);
+
+  delete current;
+  delete forecast;
+
+  return apw.getError();
+}
+
+int main()
+{
+#if INFLATE_WINDOW >= 32768
+  checkValue("allocated", (uint32_t)apw.setCompression(true), 1);
+  checkValue("gzip", request((PGM_P)forecast_gzip, FORECAST_GZIP_LENGTH, true), (uint32_t)APW_NO_ERROR);
+  checkValue("decoded bytes", apw.getStats().decoded_bytes, strlen(forecast_json));
+
+  Serial.print("wire bytes         : "); Serial.println(apw.getStats().bytes);
+  Serial.print("decoded bytes      : "); Serial.println(apw.getStats().decoded_bytes);
+  Serial.print("request loop us    : "); Serial.println(apw.getStats().total_us);
+#else
+  // The recorded response refers back further than the window
+  checkValue("window", (uint32_t)apw.setCompression(true), 0);
+  checkValue("still off", request((PGM_P)forecast_gzip, FORECAST_GZIP_LENGTH, false), (uint32_t)APW_DECODE_ERROR);
+#endif
+
+  checkValue("disabled", (uint32_t)apw.setCompression(false), 1);
+  checkValue("no decoder", request((PGM_P)forecast_gzip, FORECAST_GZIP_LENGTH, false), (uint32_t)APW_DECODE_ERROR);
+
+  const char error[] = "HTTP/1.1 404 Not Found\r\nContent-Encoding: gzip\r\nContent-Length: 3\r\n\r\nabc";
+  checkValue("error status", request(error, strlen(error), false), (uint32_t)APW_HTTP_ERROR);
+
+  return testResult("compressed");
+}
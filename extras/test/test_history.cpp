@@ -0,0 +1,140 @@
+// Check the daily history store
+
+// Years of days with gaps are added and summaries of random date ranges are compared
+// with sums over the same days kept in RAM. A day cut short by a reset must not be
+// counted, and a day from a recorded response read from a file must be stored.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include <APW_History.h>
+#include <APW_ReplayClient.h>
+
+#include "test_check.h"
+
+// HISTORY_DIR is set by CMakeLists.txt, a directory in the build tree
+fs::FS historyFS(HISTORY_DIR);
+
+#define HISTORY_DAYS   1100
+#define HISTORY_RANGES 200
+
+std::vector<APW_day_compact> days;
+
+// Summary of the days kept in RAM
+void expected(uint32_t from, uint32_t to, APW_history_summary *s)
+{
+  *s = APW_history_summary();
+  int64_t sumMax = 0, sumMin = 0;
+  int16_t high = INT16_MIN, low = INT16_MAX;
+
+  for (auto &d : days)
+  {
+    if (d.date_epoch < from || d.date_epoch > to) continue;
+    if (!s->days) s->first_epoch = d.date_epoch;
+    s->last_epoch = d.date_epoch;
+    s->days++;
+    if (d.maxtemp > high) high = d.maxtemp;
+    if (d.mintemp < low)  low  = d.mintemp;
+    sumMax += d.maxtemp;
+    sumMin += d.mintemp;
+    s->totalprecip += d.totalprecip;
+  }
+
+  if (!s->days) return;
+  s->maxtemp = high;
+  s->mintemp = low;
+  s->mean_maxtemp = sumMax / (int32_t)s->days;
+  s->mean_mintemp = sumMin / (int32_t)s->days;
+}
+
+int main()
+{
+  mkdir(HISTORY_DIR, 0755);
+  const char *files[] = { "/ny.d", "/ny.x", "/ny.n", "/ny.p", "/in.d", "/in.x", "/in.n", "/in.p" };
+  for (const char *f : files) historyFS.remove(f);
+
+  APW_History history(historyFS, "/ny");
+  srand(1);
+
+  uint32_t epoch = 1420070400; // 2015-01-01
+  for (uint32_t i = 0; i < HISTORY_DAYS; i++)
+  {
+    if (i % 100 == 50) continue; // Days with no response
+    APW_day_compact d;
+    d.date_epoch  = epoch + i * 86400;
+    d.maxtemp     = rand() % 400 - 100;
+    d.mintemp     = d.maxtemp - rand() % 150;
+    d.totalprecip = rand() % 400;
+    if (!history.add(d)) checkValue("add", i, HISTORY_DAYS);
+    days.push_back(d);
+  }
+
+  checkValue("add old day", (uint32_t)history.add(days[10]), 0);
+  checkValue("count", history.count(), days.size());
+
+  APW_day_compact r;
+  checkValue("read", (uint32_t)history.read(234, &r), 1);
+  checkValue("read date", r.date_epoch, days[234].date_epoch);
+  checkValue("read maxtemp", (uint32_t)r.maxtemp, (uint32_t)days[234].maxtemp);
+  checkValue("read mintemp", (uint32_t)r.mintemp, (uint32_t)days[234].mintemp);
+  checkValue("read precip", (uint32_t)r.totalprecip, (uint32_t)days[234].totalprecip);
+  checkValue("read past end", (uint32_t)history.read(days.size(), &r), 0);
+
+  // The whole store, then random ranges including ones outside the days stored
+  for (uint16_t t = 0; t < HISTORY_RANGES; t++)
+  {
+    uint32_t from = t ? epoch - 5 * 86400 + rand() % ((HISTORY_DAYS + 10) * 86400U) : 0;
+    uint32_t to   = t ? from + rand() % (400 * 86400U) : 0xFFFFFFFF;
+
+    APW_history_summary s, e;
+    history.summary(from, to, &s);
+    expected(from, to, &e);
+
+    if (s.days != e.days || s.first_epoch != e.first_epoch || s.last_epoch != e.last_epoch ||
+        s.maxtemp != e.maxtemp || s.mintemp != e.mintemp || s.mean_maxtemp != e.mean_maxtemp ||
+        s.mean_mintemp != e.mean_mintemp || s.totalprecip != e.totalprecip)
+      checkValue("summary days", s.days, e.days + HISTORY_DAYS);
+  }
+
+  // A day cut short by a reset, the date file is 2 bytes short
+  std::string dates = std::string(HISTORY_DIR) + "/ny.d";
+  if (truncate(dates.c_str(), (days.size() - 1) * 4 + 2)) checkText("truncate", "failed", "done");
+  checkValue("cut short count", history.count(), days.size() - 1);
+
+  APW_day_compact d = days.back();
+  d.maxtemp = 399;
+  checkValue("add again", (uint32_t)history.add(d), 1);
+  history.read(history.count() - 1, &r);
+  checkValue("count again", history.count(), days.size());
+  checkValue("maxtemp again", (uint32_t)r.maxtemp, 399);
+
+  // A recorded response read from a file through the replay client
+  File json = historyFS.open("/response.json", "w");
+  json.write((const uint8_t *)forecast_json, strlen(forecast_json));
+  json.close();
+
+  json = historyFS.open("/response.json", "r");
+  APW_ReplayClient replayClient(json);
+
+  Apixu_Weather apw;
+  apw.setClient(&replayClient);
+
+  APW_current_compact current;
+  APW_forecast_compact<1> forecast;
+  checkValue("replay", (uint32_t)apw.getForecast(&current, &forecast, "", ""), 1);
+  apw.setClient(nullptr);
+
+  APW_History ingest(historyFS, "/in");
+  checkValue("ingest", (uint32_t)ingest.add(forecast.day[0]), 1);
+  ingest.read(0, &r);
+  checkValue("ingest date", r.date_epoch, golden_date_epoch[0]);
+  checkValue("ingest maxtemp", (uint32_t)r.maxtemp, (uint32_t)forecast.day[0].maxtemp);
+
+  return testResult("history");
+}
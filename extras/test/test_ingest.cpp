@@ -0,0 +1,92 @@
+// Ingest a year of recorded responses with the parallel host ingest
+
+// The response files are written in a shuffled order with one broken file and one
+// repeated date. The store made with several workers must hold the same days as the
+// store made with one, in date order, with the broken file failed and the repeat
+// skipped. The parse and add times for each are reported.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <sys/stat.h>
+
+#include "test_check.h"
+#include "ingest.h"
+
+// INGEST_DIR is set by CMakeLists.txt, a directory in the build tree
+fs::FS ingestFS(INGEST_DIR);
+
+#define INGEST_DAYS    365
+#define INGEST_THREADS 4
+
+#define FIRST_EPOCH 1541808000 // First day in the recorded response
+
+// Stored maximum temperature of the day, deg.C x 10
+int16_t maxtemp(uint32_t i) { return (i * 37) % 400 - 100; }
+
+// Write the recorded response with the first day moved on by i days
+std::string writeDay(uint32_t i, const char *name, bool broken)
+{
+  std::string json(forecast_json);
+  char text[32];
+
+  snprintf(text, sizeof(text), "\"date_epoch\":%u", FIRST_EPOCH + i * 86400);
+  json.replace(json.find("\"date_epoch\":1541808000"), 23, text);
+  snprintf(text, sizeof(text), "\"maxtemp_c\":%d.%d", maxtemp(i) / 10, abs(maxtemp(i) % 10));
+  if (maxtemp(i) < 0 && maxtemp(i) > -10) snprintf(text, sizeof(text), "\"maxtemp_c\":-0.%d", -maxtemp(i));
+  json.replace(json.find("\"maxtemp_c\":6.5"), 15, text);
+  if (broken) json.resize(json.find("\"forecast\""));
+
+  std::string path = std::string(INGEST_DIR) + "/" + name;
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file) { fwrite(json.data(), 1, json.size(), file); fclose(file); }
+  return path;
+}
+
+int main()
+{
+  mkdir(INGEST_DIR, 0755);
+  const char *files[] = { "/s.d", "/s.x", "/s.n", "/s.p", "/p.d", "/p.x", "/p.n", "/p.p" };
+  for (const char *f : files) ingestFS.remove(f);
+
+  // Named so the file order is not the date order
+  std::vector<std::string> paths;
+  char name[32];
+  for (uint32_t i = 0; i < INGEST_DAYS; i++)
+  {
+    snprintf(name, sizeof(name), "day%03u.json", (i * 211) % INGEST_DAYS);
+    paths.push_back(writeDay(i, name, false));
+  }
+  paths.push_back(writeDay(10, "repeat.json", false));
+  paths.push_back(writeDay(INGEST_DAYS, "broken.json", true));
+  std::sort(paths.begin(), paths.end());
+
+  APW_History serial(ingestFS, "/s");
+  APW_History parallel(ingestFS, "/p");
+  ingest_result s = Ingest::run(serial, paths, 1);
+  ingest_result p = Ingest::run(parallel, paths, INGEST_THREADS);
+
+  checkValue("added",   p.added,   INGEST_DAYS);
+  checkValue("skipped", p.skipped, 1);
+  checkValue("failed",  p.failed,  1);
+  checkValue("serial added", s.added, INGEST_DAYS);
+  checkValue("count",   parallel.count(), INGEST_DAYS);
+
+  for (uint32_t i = 0; i < INGEST_DAYS; i++)
+  {
+    APW_day_compact a, b;
+    serial.read(i, &a);
+    parallel.read(i, &b);
+    if (b.date_epoch != FIRST_EPOCH + i * 86400) checkValue("date", b.date_epoch, FIRST_EPOCH + i * 86400);
+    if (b.maxtemp != maxtemp(i)) checkValue("maxtemp", (uint32_t)b.maxtemp, (uint32_t)maxtemp(i));
+    if (memcmp(&a, &b, sizeof(a))) checkValue("same as serial", i, INGEST_DAYS);
+  }
+
+  Serial.print("serial parse ms    : "); Serial.println(s.parse_us / 1000);
+  Serial.print("parallel parse ms  : "); Serial.println(p.parse_us / 1000);
+  Serial.print("add ms             : "); Serial.println(p.add_us / 1000);
+  Serial.print("files stolen       : "); Serial.println(p.stolen);
+
+  return testResult("ingest");
+}
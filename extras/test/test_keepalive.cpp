@@ -0,0 +1,106 @@
+// Reuse a kept alive connection and reconnect when the server has dropped it
+
+// The replay client below stays connected after a response, as a keep-alive server
+// does. The second request must reuse the connection. Before the third request the
+// server drops the connection, which the client only sees once the request is sent,
+// so the request must reconnect, send again and still give the golden values.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+
+#include <APW_ReplayClient.h>
+
+// Replay client for a keep-alive server that can drop the connection
+class KeptClient : public APW_ReplayClient {
+
+  public:
+    KeptClient(PGM_P message) : APW_ReplayClient(message) { }
+
+    int connect(IPAddress ip, uint16_t port) { return open(); }
+    int connect(const char *host, uint16_t port) { return open(); }
+
+    // The server closes the connection, the client sees it after the next write
+    void drop(void) { dropping = true; }
+
+    // Each request on the connection is answered with the message again
+    size_t write(const uint8_t *buf, size_t size)
+    {
+      if (dropping) dropped = true;
+      else if (!APW_ReplayClient::connected()) APW_ReplayClient::connect("", 0);
+      return APW_ReplayClient::write(buf, size);
+    }
+
+    int available(void) { return dropped ? 0 : APW_ReplayClient::available(); }
+
+    // A kept alive connection stays up after the response until it is stopped
+    uint8_t connected(void) { return !dropped && (bool)*this; }
+
+    uint32_t connects = 0;
+
+    using APW_ReplayClient::write;
+
+  private:
+    int open(void)
+    {
+      connects++;
+      dropping = dropped = false;
+      return APW_ReplayClient::connect("", 0);
+    }
+
+    bool dropping = false;
+    bool dropped  = false;
+};
+
+Apixu_Weather apw;
+
+bool request(KeptClient &client)
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  bool ok = apw.getForecast(current, forecast, "key", "New%20York");
+  checkGolden(apw, current, forecast, true);
+
+  delete current;
+  delete forecast;
+
+  return ok;
+}
+
+int main()
+{
+  String body(forecast_json);
+  String response = "HTTP/1.1 200 OK\r\nContent-Length: " + String(body.length()) +
+                    "\r\nConnection: keep-alive\r\n\r\n" + body;
+
+  KeptClient client(response.c_str());
+  apw.setClient(&client);
+  apw.setKeepAlive(true);
+  apw.setTimeouts(500, 1000);
+
+  checkValue("first", (uint32_t)request(client), 1);
+  checkValue("first connects", client.connects, (uint32_t)1);
+  checkValue("first reused", (uint32_t)apw.getStats().reused, 0);
+
+  checkValue("second", (uint32_t)request(client), 1);
+  checkValue("second connects", client.connects, (uint32_t)1);
+  checkValue("second reused", (uint32_t)apw.getStats().reused, 1);
+
+  client.drop();
+  checkValue("reconnect", (uint32_t)request(client), 1);
+  checkValue("reconnect error", (uint32_t)apw.getError(), (uint32_t)APW_NO_ERROR);
+  checkValue("reconnect connects", client.connects, (uint32_t)2);
+  checkValue("reconnect reused", (uint32_t)apw.getStats().reused, 0);
+
+  // The new connection is kept alive again
+  checkValue("after", (uint32_t)request(client), 1);
+  checkValue("after connects", client.connects, (uint32_t)2);
+
+  apw.setKeepAlive(false);
+  apw.setClient(nullptr);
+
+  return testResult("keepalive");
+}
@@ -0,0 +1,130 @@
+// Run the request loop over network links to a loopback server
+
+// The server paces the response with first byte latency, a limited rate, real TCP
+// packets and random stalls, and the library fetches it with the socket WiFiClient.
+// The median and 99th percentile fetch times, timeout rate, failures and the processor
+// time used in poll() are reported for each kind of link, so changes to the fetch loop
+// can be judged on numbers. Every link without stalls must deliver the whole response.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <algorithm>
+
+#include "test_check.h"
+#include "test_server.h"
+
+// Fetches for each link, enough for the 99th percentile to be a measured time
+#define LINK_RUNS 200
+
+typedef struct {
+  const char *name;
+  uint32_t latency_ms; // Before the first byte
+  uint32_t rate;       // bytes per second, 0 = no limit
+  uint16_t packet;     // bytes per packet, 0 = any size
+  uint32_t stall_ms;   // Longest random stall in the response, 0 = none
+  uint8_t  parallel;   // Fetches in progress together, 1 where the parse time counts
+} link_scenario;
+
+// The slow links run many fetches together so the test is quick, their parse time is
+// small against the link time
+const link_scenario scenario[] = {
+  { "local",  0,   0,       0,    0,    1  },
+  { "wifi",   20,  1000000, 1460, 0,    4  },
+  { "slow",   300, 100000,  536,  0,    25 },
+  { "drip",   50,  50000,   16,   0,    25 },
+  { "stalls", 20,  1000000, 1460, 3000, 25 },
+};
+
+#define LINK_PARALLEL 25
+
+// Shorter than the defaults so the stalls scenario shows a timeout rate quickly
+#define LINK_RESPONSE_MS 1000
+#define LINK_COMPLETE_MS 2000
+
+// One fetch in progress
+typedef struct {
+  Apixu_Weather apw;
+  APW_current   current;
+  APW_forecast  forecast;
+  uint32_t      start = 0;
+} link_fetch;
+
+int main()
+{
+  std::string body(forecast_json);
+  std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) +
+                         "\r\nConnection: close\r\n\r\n" + body;
+
+  link_fetch *fetch = new link_fetch[LINK_PARALLEL];
+  uint32_t fetchTime[LINK_RUNS];
+
+  Serial.println("link     p50 ms  p99 ms  timeouts  failed  cpu us");
+
+  for (uint8_t s = 0; s < sizeof(scenario) / sizeof(scenario[0]); s++)
+  {
+    TestServer server(response);
+    server.setLink(scenario[s].latency_ms, scenario[s].rate, scenario[s].packet, scenario[s].stall_ms);
+
+    for (uint8_t i = 0; i < scenario[s].parallel; i++)
+    {
+      fetch[i].apw.setServer("127.0.0.1", server.port());
+      fetch[i].apw.setTimeouts(LINK_RESPONSE_MS, LINK_COMPLETE_MS);
+    }
+
+    uint16_t started = 0;
+    uint16_t done = 0;
+    uint16_t timeouts = 0;
+    uint16_t failed = 0;
+    uint64_t cpu = 0;
+
+    while (done < LINK_RUNS)
+    {
+      for (uint8_t i = 0; i < scenario[s].parallel; i++)
+      {
+        link_fetch &f = fetch[i];
+
+        if (!f.apw.busy())
+        {
+          if (started == LINK_RUNS) continue;
+          started++;
+          f.forecast = APW_forecast(); // So a response cut short shows as incomplete
+          f.start = micros();
+          f.apw.beginForecast(&f.current, &f.forecast, "key", "New%20York");
+        }
+
+        // The processor time counted is for the poll() calls that did work
+        uint32_t bytes = f.apw.bytesReceived();
+        APW_state state = f.apw.getState();
+        uint32_t dt = micros();
+        f.apw.poll();
+        dt = micros() - dt;
+        if (f.apw.bytesReceived() != bytes || f.apw.getState() != state) cpu += dt;
+
+        if (f.apw.busy()) continue;
+
+        fetchTime[done++] = micros() - f.start;
+        APW_error error = f.apw.getError();
+        if (error == APW_RESPONSE_TIMEOUT || error == APW_PARSE_TIMEOUT) timeouts++;
+        if (error != APW_NO_ERROR || !f.forecast.date_epoch[GOLDEN_DAYS - 1]) failed++;
+      }
+    }
+
+    // Nearest rank percentiles
+    std::sort(fetchTime, fetchTime + LINK_RUNS);
+    uint32_t p50 = fetchTime[(LINK_RUNS * 50 + 99) / 100 - 1];
+    uint32_t p99 = fetchTime[(LINK_RUNS * 99 + 99) / 100 - 1];
+
+    Serial.printf("%-8s %6lu  %6lu  %7u%%  %5u%%  %6lu\n", scenario[s].name,
+                  (unsigned long)p50 / 1000, (unsigned long)p99 / 1000,
+                  timeouts * 100 / LINK_RUNS, failed * 100 / LINK_RUNS,
+                  (unsigned long)(cpu / LINK_RUNS));
+
+    if (!scenario[s].stall_ms) checkValue(scenario[s].name, (uint32_t)failed, 0);
+  }
+
+  delete[] fetch;
+
+  return testResult("links");
+}
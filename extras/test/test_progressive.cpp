@@ -0,0 +1,95 @@
+// Check the progressive callbacks over simulated network links
+
+// The current values and each forecast day are passed to the callbacks as they
+// arrive, before the whole response. The day callbacks are also made when only a
+// forecast is passed.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <APW_ReplayClient.h>
+
+#include "test_check.h"
+
+// Times from the start of the request, +1ms so a time under 1ms is not read as not
+// arrived
+typedef struct {
+  uint32_t start;
+  uint32_t firstValue;
+  uint32_t currentDone;
+  uint32_t firstDay;
+  uint32_t lastDay;
+  uint8_t  days;
+} progress_times;
+
+Apixu_Weather apw;
+APW_ReplayClient replayClient(forecast_json);
+
+void currentArrived(void *context, uint16_t field, APW_current *current)
+{
+  progress_times *t = (progress_times *)context;
+
+  if (!t->firstValue) t->firstValue = millis() - t->start + 1;
+
+  if (field == APW_CUR_COMPLETE)
+  {
+    t->currentDone = millis() - t->start + 1;
+    checkValue("temp", current->temp, golden_temp[0]);
+  }
+}
+
+void dayArrived(void *context, uint8_t index, APW_forecast *forecast)
+{
+  progress_times *t = (progress_times *)context;
+
+  if (!t->firstDay) t->firstDay = millis() - t->start + 1;
+  t->lastDay = millis() - t->start + 1;
+
+  checkValue("day", (uint32_t)index, t->days++);
+  checkValue("maxtemp", forecast->maxtemp[index], golden_maxtemp[0][index]);
+}
+
+int main()
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+  progress_times t;
+
+  apw.setClient(&replayClient);
+  apw.onCurrent(currentArrived, &t);
+  apw.onForecastDay(dayArrived, &t);
+
+  // Local and a 100 kbyte/s link
+  replayClient.setLink();
+  Serial.println("link     first ms  current ms  day 0 ms  days ms  done ms");
+
+  for (uint8_t s = 0; s < 2; s++)
+  {
+    if (s) replayClient.setLink(300, 100000, 536);
+
+    t = progress_times();
+    t.start = millis();
+    apw.getForecast(current, forecast, "key", "New%20York");
+    uint32_t done = millis() - t.start + 1;
+
+    checkValue("days", (uint32_t)t.days, GOLDEN_DAYS);
+    if (!t.currentDone) checkValue("current done", t.currentDone, 1);
+
+    Serial.printf("%-8s %8lu  %10lu  %8lu  %7lu  %7lu\n", s ? "slow" : "local",
+                  (unsigned long)t.firstValue, (unsigned long)t.currentDone,
+                  (unsigned long)t.firstDay, (unsigned long)t.lastDay, (unsigned long)done);
+  }
+
+  // Only a forecast passed
+  replayClient.setLink();
+  t = progress_times();
+  apw.getForecast(nullptr, forecast, "key", "New%20York");
+  checkValue("forecast only days", (uint32_t)t.days, GOLDEN_DAYS);
+  checkValue("forecast only current", t.firstValue, 0);
+
+  delete current;
+  delete forecast;
+
+  return testResult("progressive");
+}
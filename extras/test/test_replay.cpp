@@ -0,0 +1,60 @@
+// Replay the recorded forecast.json through the parser and check the golden values
+
+// The message is fed one character at a time to the same JSON_Decoder and key()/value()
+// callbacks used for a live request, in both units. The parse statistics are reported
+// so parser changes can be compared on real numbers.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+
+Apixu_Weather apw;
+
+void replayWeather(bool metric)
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  apw.setMetric(metric);
+
+  shimHeapReset();
+  bool ok = apw.replayForecast(current, forecast, forecast_json);
+  uint32_t allocations = shimHeap.allocations;
+
+  const APW_stats& stats = apw.getStats();
+
+  Serial.println(metric ? "############### Metric replay   ###############" :
+                          "############### Imperial replay ###############");
+
+  Serial.print("bytes              : "); Serial.println(stats.bytes);
+  Serial.print("key callbacks      : "); Serial.println(stats.keys);
+  Serial.print("value callbacks    : "); Serial.println(stats.values);
+  Serial.print("String stores      : "); Serial.println(stats.stores);
+  Serial.print("skipped bytes      : "); Serial.println(stats.skipped);
+  Serial.print("parse time us      : "); Serial.println(stats.parse_us);
+
+  uint32_t us = stats.parse_us ? stats.parse_us : 1;
+  Serial.print("bytes/s            : "); Serial.println((uint32_t)(stats.bytes * 1000000.0 / us));
+  Serial.print("callbacks/s        : "); Serial.println((uint32_t)((stats.keys + stats.values) * 1000000.0 / us));
+  Serial.print("heap allocations   : "); Serial.println(allocations);
+  Serial.print("peak heap used     : "); Serial.println(stats.heap_start - stats.heap_min);
+  Serial.println();
+
+  checkValue("parse ok", (uint32_t)ok, 1);
+  checkValue("bytes", stats.bytes, strlen(forecast_json));
+  checkGolden(apw, current, forecast, metric);
+  checkText ("name", current->name, "New York");
+
+  delete current;
+  delete forecast;
+}
+
+int main()
+{
+  replayWeather(true);  // mm rain, deg.C, millibars (hPa) pressure, kph
+  replayWeather(false); // inches rain, deg.F, inches pressure, mph
+
+  return testResult("replay");
+}
@@ -0,0 +1,122 @@
+// Run the request loop over the replay client with each kind of HTTP response
+
+// A bare JSON body, Content-Length and chunked responses must give the golden values,
+// an error status fails with APW_HTTP_ERROR and a framed response cut short must fail.
+// A replay or parse is refused while a request is in progress.
+// Built for the ESP32 and the ESP8266, which detect the end of a response differently.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <APW_ReplayClient.h>
+
+#include "test_check.h"
+
+Apixu_Weather apw;
+
+// Wrap the body in chunks of the given size, the last chunk is left off if cut is true
+String chunked(const char *body, size_t size, bool cut)
+{
+  String response;
+  size_t length = strlen(body);
+  for (size_t i = 0; i < length; i += size)
+  {
+    size_t count = length - i < size ? length - i : size;
+    char line[16];
+    snprintf(line, sizeof(line), "%zx\r\n", count);
+    response += line;
+    for (size_t j = 0; j < count; j++) response += body[i + j];
+    response += "\r\n";
+  }
+  if (!cut) response += "0\r\n\r\n";
+  return response;
+}
+
+// Returns the error of a request for the response
+uint32_t request(const char *name, const String &response, bool golden)
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  APW_ReplayClient client(response.c_str());
+  apw.setClient(&client);
+  apw.getForecast(current, forecast, "key", "New%20York");
+  apw.setClient(nullptr);
+
+  if (golden)
+  {
+    Serial.print(name); Serial.println(" :");
+    checkGolden(apw, current, forecast, true);
+  }
+
+  delete current;
+  delete forecast;
+
+  return apw.getError();
+}
+
+int main()
+{
+  String body(forecast_json);
+  String length = "HTTP/1.1 200 OK\r\nContent-Length: " + String(body.length()) + "\r\n\r\n";
+  String header = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+
+  apw.setTimeouts(100, 200);
+
+  checkValue("bare",       request("bare", body, true), (uint32_t)APW_NO_ERROR);
+  checkValue("length",     request("length", length + body, true), (uint32_t)APW_NO_ERROR);
+  checkValue("chunked 7",  request("chunked 7", header + chunked(forecast_json, 7, false), true), (uint32_t)APW_NO_ERROR);
+  checkValue("chunked 1k", request("chunked 1k", header + chunked(forecast_json, 1000, false), true), (uint32_t)APW_NO_ERROR);
+
+  String error = "HTTP/1.1 400 Bad Request\r\nContent-Length: 20\r\n\r\n{\"error\":{\"code\":1}}";
+  checkValue("status", request("status", error, false), (uint32_t)APW_HTTP_ERROR);
+  checkValue("status code", (uint32_t)apw.getStats().status, 400);
+
+  // An empty body is complete at once, also with the header split over packets
+  String empty = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nConnection: keep-alive\r\n\r\n";
+  uint32_t start = millis();
+  checkValue("empty", request("empty", empty, false), (uint32_t)APW_PARSE_ERROR);
+  checkValue("empty body", apw.getStats().body_bytes, 0);
+  APW_ReplayClient split(empty.c_str());
+  split.setLink(0, 0, 8);
+  apw.setClient(&split);
+  APW_current empty_current;
+  apw.getForecast(&empty_current, nullptr, "key", "New%20York");
+  apw.setClient(nullptr);
+  checkValue("empty split", (uint32_t)apw.getError(), (uint32_t)APW_PARSE_ERROR);
+  checkValue("empty no timeout", (uint32_t)(millis() - start < 100), 1);
+
+  // The connection closes before the end of the response. The ESP32 does not check
+  // the connection, so the response times out.
+#ifdef ESP32
+  APW_error cut = APW_PARSE_TIMEOUT;
+#else
+  APW_error cut = APW_INCOMPLETE_ERROR;
+#endif
+  String longer = "HTTP/1.1 200 OK\r\nContent-Length: " + String(body.length() + 10) + "\r\n\r\n";
+  checkValue("length cut",  request("length cut", longer + body, false), (uint32_t)cut);
+  checkValue("chunked cut", request("chunked cut", header + chunked(forecast_json, 100, true), false), (uint32_t)cut);
+
+  // A replay or parse while a request is in progress must not touch the request
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+  String response = length + body;
+  APW_ReplayClient slow(response.c_str());
+  slow.setLink(50);
+  apw.setTimeouts(1000, 2000);
+  apw.setClient(&slow);
+  checkValue("begin", (uint32_t)apw.beginForecast(current, forecast, "key", "New%20York"), 1);
+  while (apw.getState() < APW_PARSE) apw.poll();
+  checkValue("replay busy", (uint32_t)apw.replayForecast(current, forecast, forecast_json), 0);
+  checkValue("parse busy", (uint32_t)apw.parseForecast(current, forecast, forecast_json, strlen(forecast_json)), 0);
+  checkValue("message busy", (uint32_t)apw.parseMessage(forecast_json), 0);
+  while (apw.poll() < APW_DONE) yield();
+  apw.setClient(nullptr);
+  checkValue("busy request", (uint32_t)apw.getError(), (uint32_t)APW_NO_ERROR);
+  checkGolden(apw, current, forecast, true);
+  delete current;
+  delete forecast;
+
+  return testResult("request");
+}
@@ -0,0 +1,89 @@
+// Fetch times from the adaptive scheduler
+
+// The next fetch is due the update interval plus SCHEDULE_MARGIN after the
+// last_updated_epoch seen, an early fetch is retried after SCHEDULE_RETRY seconds
+// doubled each time, and failed fetches back off up to SCHEDULE_BACKOFF with a random
+// part. The shim clock is moved on with shimAdvance() so no test waits.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+#include <APW_Scheduler.h>
+
+#define SERVER_TIME 1541843000 // Server local time of the first fetch
+
+APW_current current;
+
+// A fetch at the scheduler time that found values last updated at updated
+void fetch(APW_Scheduler &scheduler, uint32_t updated)
+{
+  current.localtime_epoch    = scheduler.now() ? scheduler.now() : SERVER_TIME;
+  current.last_updated_epoch = updated;
+  scheduler.fetched(&current);
+}
+
+// Moves the clock on by the seconds until the next fetch
+void waitDue(APW_Scheduler &scheduler)
+{
+  shimAdvance(scheduler.secondsUntil() * 1000UL);
+  if (!scheduler.due()) checkValue("due", scheduler.secondsUntil(), 0);
+}
+
+int main()
+{
+  APW_Scheduler scheduler;
+  checkValue("first due", (uint32_t)scheduler.due(), 1);
+  checkValue("no clock",  scheduler.now(), 0);
+
+  // Updated 300 s ago, the next update is 600 s away and published SCHEDULE_MARGIN later
+  fetch(scheduler, SERVER_TIME - 300);
+  checkValue("now",       scheduler.now(), SERVER_TIME);
+  checkValue("next",      scheduler.secondsUntil(), SCHEDULE_INTERVAL - 300 + SCHEDULE_MARGIN);
+  shimAdvance((SCHEDULE_INTERVAL - 300 + SCHEDULE_MARGIN - 1) * 1000UL);
+  checkValue("not due",   (uint32_t)scheduler.due(), 0);
+  checkValue("clock",     scheduler.now(), SERVER_TIME + SCHEDULE_INTERVAL - 300 + SCHEDULE_MARGIN - 1);
+  shimAdvance(1000);
+  checkValue("due",       (uint32_t)scheduler.due(), 1);
+
+  // No new values yet, the retries double
+  fetch(scheduler, SERVER_TIME - 300);
+  checkValue("retry 1",   scheduler.secondsUntil(), SCHEDULE_RETRY);
+  waitDue(scheduler);
+  fetch(scheduler, SERVER_TIME - 300);
+  checkValue("retry 2",   scheduler.secondsUntil(), 2 * SCHEDULE_RETRY);
+  checkValue("unchanged", scheduler.unchanged, 2);
+
+  // Updates 600 s apart shorten the interval at once
+  waitDue(scheduler);
+  fetch(scheduler, SERVER_TIME + 300);
+  checkValue("interval",  scheduler.interval(), 600);
+  uint32_t next = SERVER_TIME + 300 + 600 + SCHEDULE_MARGIN;
+  checkValue("next update", scheduler.now() + scheduler.secondsUntil(), next);
+
+  // The clock runs on over a deep sleep
+  uint32_t sleep = scheduler.sleepSeconds();
+  checkValue("sleep",     sleep, next - scheduler.now());
+  scheduler.wake(sleep);
+  checkValue("wake due",  (uint32_t)scheduler.due(), 1);
+
+  // Failures back off between half and all of SCHEDULE_RETRY doubled, up to SCHEDULE_BACKOFF
+  APW_Scheduler failing;
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    failing.failed();
+    uint32_t backoff = (uint32_t)SCHEDULE_RETRY << (i < 6 ? i : 6);
+    if (backoff > SCHEDULE_BACKOFF) backoff = SCHEDULE_BACKOFF;
+    uint32_t wait = failing.secondsUntil();
+    if (wait < backoff / 2 || wait > backoff) checkValue("backoff", wait, backoff);
+    waitDue(failing);
+  }
+  checkValue("failures",  failing.failures, 10);
+
+  // A success after failures fetches again on the next update
+  fetch(failing, failing.now() - 100);
+  checkValue("recovered", failing.secondsUntil(), SCHEDULE_INTERVAL - 100 + SCHEDULE_MARGIN);
+
+  return testResult("scheduler");
+}
@@ -0,0 +1,209 @@
+// Loopback HTTP server for the host tests
+
+// Serves one response to every request on 127.0.0.1, each connection on its own
+// thread, so the library's WiFiClient transport can be run over real sockets. The
+// connection is kept open for further requests if keepAlive is set, otherwise it is
+// closed after each response. setLink() paces the response like a network link, as
+// APW_ReplayClient::setLink() does, but over the socket so the packets are real.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#ifndef test_server_h
+#define test_server_h
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+class TestServer {
+
+  public:
+    // Listen on a free loopback port for requests, each answered with the response
+    TestServer(const std::string &response, bool keepAlive = false)
+      : response(response), keepAlive(keepAlive)
+    {
+      listener = socket(AF_INET, SOCK_STREAM, 0);
+      int one = 1;
+      setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+      sockaddr_in address = {};
+      address.sin_family      = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      socklen_t size = sizeof(address);
+      bind(listener, (sockaddr *)&address, size);
+      listen(listener, 64);
+      getsockname(listener, (sockaddr *)&address, &size);
+      serverPort = ntohs(address.sin_port);
+
+      acceptor = std::thread(&TestServer::acceptLoop, this);
+    }
+
+    // Stops listening and waits for the connections to close
+    ~TestServer()
+    {
+      running = false;
+      acceptor.join();
+      close(listener);
+      for (std::thread &t : connections) t.join();
+    }
+
+    uint16_t port(void) { return serverPort; }
+
+    // latency_ms before the first byte, rate bytes per second (0 = no limit), the
+    // response sent in packets of packet bytes (0 = any size) and a random stall of up
+    // to stall_ms at a random point in each response (0 = no stalls). Set before the
+    // first request.
+    void setLink(uint32_t latency_ms = 0, uint32_t rate = 0, uint16_t packet = 0, uint32_t stall_ms = 0)
+    {
+      latency = latency_ms;
+      this->rate = rate;
+      this->packet = packet;
+      stallMax = stall_ms;
+    }
+
+    // Requests containing match are answered with response instead, e.g. an error for
+    // one city. Set before the first request.
+    void route(const std::string &match, const std::string &response)
+    {
+      routes.emplace_back(match, response);
+    }
+
+    // The text of the last request received
+    std::string lastRequest(void) { std::lock_guard<std::mutex> lock(mutex); return request; }
+
+    std::atomic<uint32_t> accepted { 0 }; // Connections accepted
+    std::atomic<uint32_t> requests { 0 }; // Requests answered
+
+  private:
+    // Send the response on the connection paced by the link, false if the connection
+    // has closed
+    bool respond(int fd, const std::string &response, std::minstd_rand &random)
+    {
+      using namespace std::chrono;
+
+      size_t size     = response.size();
+      size_t stallAt  = stallMax ? random() % size : size;
+      uint32_t stallFor = stallMax ? random() % stallMax : 0;
+
+      // Without a packet size the paced response is sent 10ms at a time
+      size_t step = packet ? packet : (rate ? rate / 100 + 1 : size);
+
+      std::this_thread::sleep_for(milliseconds(latency));
+      steady_clock::time_point start = steady_clock::now();
+
+      size_t sent = 0;
+      while (sent < size)
+      {
+        size_t count = size - sent < step ? size - sent : step;
+        if (sent < stallAt && sent + count > stallAt) count = stallAt - sent;
+
+        // The last byte of the packet has arrived at the link rate
+        if (rate) std::this_thread::sleep_until(start + microseconds((uint64_t)(sent + count) * 1000000 / rate));
+
+        for (size_t done = 0; done < count; )
+        {
+          ssize_t n = send(fd, response.data() + sent + done, count - done, MSG_NOSIGNAL);
+          if (n <= 0) return false;
+          done += n;
+        }
+        sent += count;
+
+        if (sent == stallAt && stallFor)
+        {
+          std::this_thread::sleep_for(milliseconds(stallFor));
+          start += milliseconds(stallFor);
+        }
+      }
+      return true;
+    }
+
+    // Wait for a connection, checking for the server to stop
+    void acceptLoop(void)
+    {
+      while (running)
+      {
+        pollfd p = { listener, POLLIN, 0 };
+        if (poll(&p, 1, 10) <= 0) continue;
+
+        int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        accepted++;
+        connections.emplace_back(&TestServer::serve, this, fd);
+      }
+    }
+
+    // Answer requests on a connection until it is closed
+    void serve(int fd)
+    {
+      std::string text;
+      char buffer[512];
+      std::minstd_rand random(++seeds); // A different stall for each connection
+
+      while (running)
+      {
+        pollfd p = { fd, POLLIN, 0 };
+        if (poll(&p, 1, 10) <= 0) continue;
+
+        ssize_t count = recv(fd, buffer, sizeof(buffer), 0);
+        if (count <= 0) break;
+        text.append(buffer, count);
+
+        // A GET request has no body, it ends with a blank line
+        size_t end = text.find("\r\n\r\n");
+        if (end == std::string::npos) continue;
+        std::string received = text.substr(0, end + 4);
+        text.erase(0, end + 4);
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          request = received;
+        }
+
+        const std::string *answer = &response;
+        for (auto &r : routes) if (received.find(r.first) != std::string::npos) answer = &r.second;
+
+        if (!respond(fd, *answer, random)) break;
+        requests++;
+        if (!keepAlive) break;
+      }
+
+      close(fd);
+    }
+
+    const std::string response;
+    const bool        keepAlive;
+    std::atomic<bool> running { true };
+
+    std::atomic<uint32_t> seeds { 0 };
+
+    std::vector<std::pair<std::string, std::string>> routes; // Set by route()
+
+    // Link pacing, set by setLink()
+    uint32_t latency  = 0; // ms before the first byte
+    uint32_t rate     = 0; // bytes per second, 0 = no limit
+    uint16_t packet   = 0; // bytes per packet, 0 = any size
+    uint32_t stallMax = 0; // Longest stall in ms, 0 = no stalls
+
+    int           listener   = -1;
+    uint16_t      serverPort = 0;
+    std::thread   acceptor;
+    std::vector<std::thread> connections;
+    std::mutex    mutex;
+    std::string   request;
+};
+
+#endif
@@ -0,0 +1,79 @@
+// Save a snapshot and restore it in the other units
+
+// A snapshot as a sketch would keep in RTC memory over a deep sleep, restored in the
+// other units and checked against the golden values. A corrupted snapshot must be
+// rejected. The snapshot is also restored from a file mapped with mmap(), as it is
+// on Linux, and with only the forecast wanted so the current values are skipped.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "test_check.h"
+
+Apixu_Weather apw;
+
+int main()
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+  uint8_t snapshot[APW_SNAPSHOT_SIZE];
+
+  apw.setMetric(true);
+  apw.replayForecast(current, forecast, forecast_json);
+
+  uint32_t dt = micros();
+  size_t length = apw.saveSnapshot(snapshot, sizeof(snapshot), current, forecast);
+  uint32_t saveTime = micros() - dt;
+
+  delete current;
+  delete forecast;
+  current  = new APW_current;
+  forecast = new APW_forecast;
+
+  apw.setMetric(false);
+  dt = micros();
+  bool loaded = apw.loadSnapshot(snapshot, length, current, forecast);
+  dt = micros() - dt;
+
+  checkValue("loaded", (uint32_t)loaded, 1);
+  checkGolden(apw, current, forecast, false);
+  checkText ("name", current->name, "New York");
+
+  // Restore the forecast from a mapped snapshot file, skipping the current values
+  APW_forecast *mapped = new APW_forecast;
+  FILE *file = fopen(SNAPSHOT_FILE, "wb");
+  if (file) { fwrite(snapshot, 1, length, file); fclose(file); }
+  int fd = open(SNAPSHOT_FILE, O_RDONLY);
+  void *map = (fd < 0) ? MAP_FAILED : mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  checkValue("mapped", (uint32_t)(map != MAP_FAILED), 1);
+  if (map != MAP_FAILED)
+  {
+    checkValue("mapped loaded", (uint32_t)apw.loadSnapshot((const uint8_t *)map, length, nullptr, mapped), 1);
+    for (int i = 0; i < GOLDEN_DAYS; i++)
+    {
+      checkValue("mapped date_epoch", mapped->date_epoch[i], golden_date_epoch[i]);
+      checkValue("mapped maxtemp",    mapped->maxtemp[i],    forecast->maxtemp[i]);
+      checkText ("mapped moonset",    mapped->moonset[i],    golden_moonset[i]);
+    }
+    munmap(map, length);
+  }
+  if (fd >= 0) close(fd);
+  delete mapped;
+
+  snapshot[length / 2] ^= 1;
+  checkValue("corrupt", (uint32_t)apw.loadSnapshot(snapshot, length, current, forecast), 0);
+
+  Serial.print("Snapshot bytes     : "); Serial.println(length);
+  Serial.print("Save us            : "); Serial.println(saveTime);
+  Serial.print("Restore us         : "); Serial.println(dt);
+
+  delete current;
+  delete forecast;
+
+  return testResult("snapshot");
+}
@@ -0,0 +1,84 @@
+// Run requests over the default WiFiClient transport to a loopback server
+
+// On the host WiFiClient is a TCP socket, so with setServer() set to a server on
+// 127.0.0.1 the library resolves the address and connects as it does on the board.
+// The values must match the golden values, a kept alive connection must be reused
+// and reconnected after the server has closed it, and a refused connection must fail
+// with APW_CONNECT_FAILED. Built for the ESP32 and the ESP8266.
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+#include "test_server.h"
+
+Apixu_Weather apw;
+
+// Returns the error of a request to the server set by setServer()
+uint32_t request(bool golden)
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  apw.getForecast(current, forecast, "key", "New%20York");
+
+  if (golden) checkGolden(apw, current, forecast, true);
+
+  delete current;
+  delete forecast;
+
+  return apw.getError();
+}
+
+int main()
+{
+  std::string body(forecast_json);
+  std::string length = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+
+  apw.setTimeouts(1000, 2000);
+
+  {
+    std::string response = length + "Connection: close\r\n\r\n" + body;
+    TestServer server(response);
+    apw.setServer("127.0.0.1", server.port());
+    checkValue("socket", request(true), (uint32_t)APW_NO_ERROR);
+    checkValue("bytes", apw.getStats().bytes, (uint32_t)response.size());
+    checkText ("request", server.lastRequest().substr(0, 22).c_str(), "GET /v1/forecast.json?");
+    checkValue("accepted", server.accepted, 1);
+  }
+
+  // Kept alive, the second request is sent on the same connection
+  {
+    TestServer server(length + "Connection: keep-alive\r\n\r\n" + body, true);
+    apw.setServer("127.0.0.1", server.port());
+    apw.setKeepAlive(true);
+    checkValue("first",         request(false), (uint32_t)APW_NO_ERROR);
+    checkValue("second",        request(true), (uint32_t)APW_NO_ERROR);
+    checkValue("second reused", (uint32_t)apw.getStats().reused, 1);
+    checkValue("kept accepted", server.accepted, 1);
+    checkValue("kept requests", server.requests, 2);
+  }
+
+  // The server has closed the kept connection, the next request connects again
+  {
+    TestServer server(length + "Connection: keep-alive\r\n\r\n" + body);
+    apw.setServer("127.0.0.1", server.port());
+    checkValue("open",          request(false), (uint32_t)APW_NO_ERROR);
+    delay(50); // The close reaches the client
+    checkValue("reconnect",     request(true), (uint32_t)APW_NO_ERROR);
+    checkValue("reconnected",   server.accepted, 2);
+    apw.setKeepAlive(false);
+  }
+
+  // Nothing listens on the port once the server has gone
+  uint16_t port;
+  {
+    TestServer server("");
+    port = server.port();
+  }
+  apw.setServer("127.0.0.1", port);
+  checkValue("refused", request(false), (uint32_t)APW_CONNECT_FAILED);
+
+  return testResult("socket");
+}
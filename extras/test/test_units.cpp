@@ -0,0 +1,48 @@
+// Parse once and check both unit sets, and the changed bits of a repeat parse
+
+// Both unit sets are captured by one parse, applyUnits() swaps them without a new
+// parse. A repeat of the same message into the same structs changes nothing, and only
+// the swapped unit values are flagged by applyUnits().
+
+// Created by Bodmer 10/11/2018
+
+// See license.txt in root folder of library
+
+#include "test_check.h"
+
+Apixu_Weather apw;
+
+int main()
+{
+  APW_current  *current  = new APW_current;
+  APW_forecast *forecast = new APW_forecast;
+
+  apw.setMetric(true);
+  apw.replayForecast(current, forecast, forecast_json);
+  checkGolden(apw, current, forecast, true);
+
+  uint32_t dt = micros();
+  apw.setMetric(false);
+  apw.applyUnits(current, forecast);
+  dt = micros() - dt;
+  checkGolden(apw, current, forecast, false);
+
+  current->changed = 0;
+  for (uint8_t i = 0; i < MAX_DAYS; i++) forecast->changed[i] = 0;
+
+  apw.replayForecast(current, forecast, forecast_json);
+  checkValue("repeat changed",    (uint32_t)current->changed, 0);
+  checkValue("repeat changed[0]", (uint32_t)forecast->changed[0], 0);
+
+  apw.setMetric(true);
+  apw.applyUnits(current, forecast);
+  checkValue("units changed",    (uint32_t)current->changed, APW_CUR_UNITS);
+  checkValue("units changed[0]", (uint32_t)forecast->changed[0], APW_DAY_UNITS);
+
+  Serial.print("applyUnits us      : "); Serial.println(dt);
+
+  delete current;
+  delete forecast;
+
+  return testResult("units");
+}